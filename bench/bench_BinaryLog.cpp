@@ -0,0 +1,40 @@
+#include "BinaryLog.hpp"
+
+#include <filesystem>
+#include <format>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[BinaryLog] Per-step diagnostics, text formatting vs binary records", "[BinaryLog]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_bench_BinaryLog.fpbl";
+        double dt = 0.01, error = 1e-16, speed = 171.0, altitude = 3657.4;
+
+        BENCHMARK("std::format")
+        {
+            dt += 1e-9;
+            return std::format("dt={:.4f} ortho={:.3e} |vb|={:.3f} alt={:.1f}", dt, error, speed, altitude);
+        };
+
+        BinaryLog::Open(path.string());
+        BENCHMARK("BinaryLog::Write")
+        {
+            dt += 1e-9;
+            BinaryLog::Write<"dt={:.4f} ortho={:.3e} |vb|={:.3f} alt={:.1f}">(dt, error, speed, altitude);
+            return dt;
+        };
+        BinaryLog::Close();
+
+        BENCHMARK("BinaryLog::Write (no session)")
+        {
+            dt += 1e-9;
+            BinaryLog::Write<"dt={:.4f} ortho={:.3e} |vb|={:.3f} alt={:.1f}">(dt, error, speed, altitude);
+            return dt;
+        };
+
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,52 @@
+#include "Mat4.hpp"
+#include "Mat4Kernels.hpp"
+
+#include <cmath>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace FlightPath
+{
+    // small rotation around all three axes, chained products stay bounded like frame_ = frame_ * other
+    template <typename REAL>
+    static auto GetRotation() -> Mat4<REAL>
+    {
+        const REAL c = std::cos(REAL(0.01));
+        const REAL s = std::sin(REAL(0.01));
+        const Mat4<REAL> Rx({REAL(1), REAL(0), REAL(0), REAL(0),  REAL(0), c, -s, REAL(0),  REAL(0), s, c, REAL(0),  REAL(0), REAL(0), REAL(0), REAL(1)});
+        const Mat4<REAL> Rz({c, -s, REAL(0), REAL(0),  s, c, REAL(0), REAL(0),  REAL(0), REAL(0), REAL(1), REAL(0),  REAL(0), REAL(0), REAL(0), REAL(1)});
+        return Rx * Rz;
+    }
+
+    TEMPLATE_TEST_CASE("[Mat4] Matrix Matrix Multiplication per kernel", "[Mat4]", float, double)
+    {
+        const Mat4<TestType> B = GetRotation<TestType>();
+
+        for (const auto level : {Kernels::SimdLevel::Scalar, Kernels::SimdLevel::AVX2, Kernels::SimdLevel::AVX512})
+        {
+            if (!Kernels::IsSupported(level))
+            {
+                continue;
+            }
+
+            Mat4<TestType> A = B;
+            BENCHMARK(std::string(Kernels::ToString(level)))
+            {
+                Mat4<TestType> C;
+                Kernels::Multiply4x4(A.RawPtr(), B.RawPtr(), C.RawPtr(), level);
+                A = C;
+                return A(0, 0);
+            };
+        }
+
+        Mat4<TestType> A = B;
+        BENCHMARK(std::string("Mat4::operator* (") + std::string(Kernels::ToString(Kernels::GetSimdLevel())) + ")")
+        {
+            A = A * B;
+            return A(0, 0);
+        };
+    }
+}
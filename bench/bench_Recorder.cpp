@@ -0,0 +1,55 @@
+#include "Recorder.hpp"
+
+#include <filesystem>
+#include <ranges>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[Recorder] Parse and export the Graz-Gleichenberg flight", "[Recorder]")
+    {
+        const std::string input = std::string(PROJECT_ROOT_PATH) + "/data/Graz-Gleichenberg.txt";
+        const auto directory = std::filesystem::temp_directory_path();
+
+        BENCHMARK("Recorder::ReadFile")
+        {
+            Recorder recorder;
+            recorder.ReadFile(input);
+            return recorder.GetData().size();
+        };
+
+        // the reconstructed track is the original one, only the amount of data matters here
+        Recorder recorder;
+        recorder.ReadFile(input);
+        for (const auto &entry : recorder.GetData() | std::views::drop(1))
+        {
+            recorder.WriteData(
+                Position{.longitude = entry.longitude, .latitude = entry.latitude, .altitude = entry.altitude},
+                Attitude{.heading = entry.true_heading, .pitch = entry.pitch, .roll = entry.roll},
+                Vec3<double>(entry.v_x, entry.v_y, entry.v_z));
+        }
+
+        const std::string kml = (directory / "FlightPath_bench_Recorder.kml").string();
+        BENCHMARK("Recorder::DumpKML (every entry)")
+        {
+            recorder.DumpKML(kml, 1);
+        };
+
+        BENCHMARK("Recorder::DumpSimplifiedKML (5 m)")
+        {
+            recorder.DumpSimplifiedKML(kml, 5.0);
+        };
+
+        const std::string columnar = (directory / "FlightPath_bench_Recorder.fpc").string();
+        BENCHMARK("Recorder::DumpColumnar")
+        {
+            recorder.DumpColumnar(columnar);
+        };
+
+        std::filesystem::remove(kml);
+        std::filesystem::remove(columnar);
+    }
+}
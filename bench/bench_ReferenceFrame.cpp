@@ -0,0 +1,61 @@
+#include "ReferenceFrame.hpp"
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace FlightPath
+{
+    // one integration step of Application::Run (turn with climb), leaves the frame slightly non-orthogonal
+    static auto GetStep() -> Mat4<double>
+    {
+        constexpr double dt = 0.01;
+        return Mat4<double>(
+             1.0,          -0.05 * dt,  0.01 * dt, 170.0 * dt,
+             0.05 * dt,     1.0,       -0.02 * dt,   0.0,
+            -0.01 * dt,     0.02 * dt,  1.0,         3.0 * dt,
+             0.0,           0.0,        0.0,         1.0);
+    }
+
+    TEST_CASE("[ReferenceFrame] Frame operations", "[ReferenceFrame]")
+    {
+        const Position position{.longitude = 15.44_deg, .latitude = 47.0_deg, .altitude = 3657.4_m};
+        const Attitude attitude{.heading = 194.4_deg, .pitch = 4.1_deg, .roll = 14.6_deg};
+
+        ReferenceFrame frame(position);
+        frame.SetAttitude(attitude);
+
+        // every run orthonormalizes its own freshly perturbed copy
+        BENCHMARK_ADVANCED("ReferenceFrame::Orthonormalize")(Catch::Benchmark::Chronometer meter)
+        {
+            ReferenceFrame perturbed = frame;
+            perturbed.Dot(GetStep());
+            std::vector<ReferenceFrame> frames(static_cast<size_t>(meter.runs()), perturbed);
+
+            meter.measure([&frames](const int i)
+            {
+                frames[static_cast<size_t>(i)].Orthonormalize();
+                Catch::Benchmark::keep_memory(&frames[static_cast<size_t>(i)]);
+            });
+        };
+
+        BENCHMARK("ReferenceFrame::GetPosition")
+        {
+            return frame.GetPosition();
+        };
+
+        BENCHMARK("ReferenceFrame::GetAttitude")
+        {
+            return frame.GetAttitude();
+        };
+
+        Attitude changing = attitude;
+        BENCHMARK("ReferenceFrame::SetAttitude")
+        {
+            changing.heading += 1e-6;
+            frame.SetAttitude(changing);
+            Catch::Benchmark::keep_memory(&frame);
+        };
+    }
+}
@@ -0,0 +1,35 @@
+#include "Vec3.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace FlightPath
+{
+    // keep_memory forces the operands to be reloaded in every iteration, so the operation can not be hoisted out of the loop
+    TEMPLATE_TEST_CASE("[Vec3] Cross, Dot and Normalize", "[Vec3]", float, double)
+    {
+        Vec3<TestType> a(TestType(1.0), TestType(2.0), TestType(3.0));
+        Vec3<TestType> b(TestType(-1.0), TestType(0.5), TestType(2.0));
+
+        BENCHMARK("Vec3::Cross")
+        {
+            Catch::Benchmark::keep_memory(&a);
+            return a.Cross(b);
+        };
+
+        BENCHMARK("Vec3::Dot")
+        {
+            Catch::Benchmark::keep_memory(&a);
+            return a.Dot(b);
+        };
+
+        BENCHMARK("Vec3::Normalize")
+        {
+            Catch::Benchmark::keep_memory(&a);
+            Vec3<TestType> c = a;
+            c.Normalize();
+            return c;
+        };
+    }
+}
@@ -0,0 +1,44 @@
+#include "Vec3.hpp"
+#include "Vec3Array.hpp"
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace FlightPath
+{
+    TEMPLATE_TEST_CASE("[Vec3Array] Cross and Normalize, array of structs vs structure of arrays", "[Vec3Array]", float, double)
+    {
+        constexpr size_t n = 10'000;
+
+        std::vector<Vec3<TestType>> a_aos(n), b_aos(n), c_aos(n);
+        Vec3Array<TestType> a_soa(n), b_soa(n), c_soa(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            const TestType t = TestType(i) * TestType(0.001);
+            a_aos[i] = Vec3<TestType>(TestType(1) + t, TestType(2) - t, TestType(3));
+            b_aos[i] = Vec3<TestType>(TestType(-1), TestType(0.5) * t, TestType(1) + t);
+            a_soa.Set(i, a_aos[i]);
+            b_soa.Set(i, b_aos[i]);
+        }
+
+        BENCHMARK("std::vector<Vec3>")
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                c_aos[i] = a_aos[i].Cross(b_aos[i]);
+                c_aos[i] = c_aos[i] * (TestType(1) / c_aos[i].Length());
+            }
+            return c_aos[n - 1].x;
+        };
+
+        BENCHMARK("Vec3Array")
+        {
+            Cross<TestType>(a_soa.View(), b_soa.View(), c_soa.View());
+            Normalize<TestType>(c_soa.View());
+            return c_soa.X()[n - 1];
+        };
+    }
+}
@@ -0,0 +1,135 @@
+// End-to-end throughput of FlightPath on synthetic flights: generate -> read -> reconstruct -> export.
+//
+// Usage: FlightPathE2EBench [sample_count...]   (default: 100000 1000000)
+//
+// Every stage reports its wall time, samples per second and the peak resident set size while it
+// ran. The reconstruction only integrates the poses, the export writes both tracks to KML the way
+// Application::Run streams them. Note: the input file takes about 130 bytes per sample (13 GB for 10^8 samples) and is
+// written to the temporary directory.
+
+#include "KML.hpp"
+#include "KMLSink.hpp"
+#include "Memory.hpp"
+#include "Reconstruction.hpp"
+#include "Recorder.hpp"
+#include "SyntheticFlight.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace FlightPath;
+
+    // redirects standard output while it exists, also if the stage throws
+    class SilenceOutput
+    {
+    public:
+        SilenceOutput() : buffer_(std::cout.rdbuf(silenced_.rdbuf())) {}
+        ~SilenceOutput() { std::cout.rdbuf(buffer_); }
+
+        SilenceOutput(const SilenceOutput&) = delete;
+        auto operator=(const SilenceOutput&) -> SilenceOutput& = delete;
+
+    private:
+        std::ostringstream silenced_;
+        std::streambuf    *buffer_;
+    };
+
+    // runs a stage with standard output silenced (the library logs its progress) and prints its statistics
+    template <typename Function>
+    auto RunStage(const std::string_view name, const size_t sample_count, const bool resettable, Function &&function) -> void
+    {
+        ResetPeakResidentMemory();
+
+        std::chrono::steady_clock::time_point start, end;
+        {
+            SilenceOutput silence;
+            start = std::chrono::steady_clock::now();
+            function();
+            end = std::chrono::steady_clock::now();
+        }
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        std::cout << std::format("  {:<24} {:>9.3f} s {:>14.0f} samples/s {:>10.1f} MiB peak RSS{}\n",
+            name, seconds, static_cast<double>(sample_count) / seconds,
+            static_cast<double>(GetResidentMemory().peak) / (1024.0 * 1024.0), resettable ? "" : " (process)");
+    }
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+    using namespace FlightPath;
+
+    std::vector<size_t> sample_counts;
+    for (int i = 1; i < argc; ++i)
+    {
+        sample_counts.push_back(std::strtoull(argv[i], nullptr, 10));
+        if (sample_counts.back() < 2)
+        {
+            std::cerr << std::format("Invalid sample count {}, expected at least 2\n", argv[i]);
+            return 1;
+        }
+    }
+    if (sample_counts.empty())
+    {
+        sample_counts = {100'000, 1'000'000};
+    }
+
+    const auto directory  = std::filesystem::temp_directory_path();
+    const auto input_path = directory / "FlightPath_e2e.txt";
+    const auto kml_path   = directory / "FlightPath_e2e.kml";
+    const bool resettable = ResetPeakResidentMemory();
+
+    try
+    {
+        for (const size_t sample_count : sample_counts)
+        {
+            std::cout << std::format("{} samples:\n", sample_count);
+
+            RunStage("generate", sample_count, resettable, [&] { WriteSyntheticFlight(input_path.string(), sample_count); });
+
+            Recorder recorder;
+            RunStage("read", sample_count, resettable, [&] { recorder.ReadFile(input_path.string()); });
+
+            const auto &data = recorder.GetData();
+            std::vector<Pose> poses;
+            RunStage("reconstruct", sample_count, resettable, [&]
+            {
+                poses.resize(data.size());
+                Reconstruct(data, GetInitialState(data[0]), poses);
+            });
+
+            RunStage("export", sample_count, resettable, [&]
+            {
+                KMLSink sink(kml_path.string(), 5.0);
+                sink.WriteTrack(KML::OpenOriginalDataset, data);
+                sink.BeginTrack(KML::OpenReconstructedDataset);
+                for (const Pose &pose : poses)
+                {
+                    sink.Push(recorder.WriteData(pose.position, pose.attitude, pose.velocity));
+                }
+                sink.EndTrack();
+                sink.Close();
+            });
+
+            std::filesystem::remove(input_path);
+            std::filesystem::remove(kml_path);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << '\n';
+        std::filesystem::remove(input_path);
+        std::filesystem::remove(kml_path);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace FlightPath
+{
+    /**
+     * @brief Minimal standard allocator returning memory aligned to a fixed boundary.
+     *
+     * Used for containers that are processed with SIMD instructions, so that the
+     * first element of every buffer starts on a cache line.
+     *
+     * @tparam T         The allocated type.
+     * @tparam Alignment The alignment in bytes (power of two).
+     */
+    template <typename T, size_t Alignment = 64>
+    struct AlignedAllocator
+    {
+        using value_type = T; ///< The allocated type.
+
+        /// @brief Rebinds the allocator to another type with the same alignment.
+        template <typename U>
+        struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+        /** @brief Default constructor. */
+        constexpr AlignedAllocator() noexcept = default;
+
+        /** @brief Converting constructor from an allocator of another type. */
+        template <typename U>
+        constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        /**
+         * @brief Allocates aligned, uninitialized storage.
+         * @param n Number of objects to allocate storage for.
+         * @return Pointer to the first object.
+         */
+        [[nodiscard]] auto allocate(const size_t n) -> T*
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+        }
+
+        /**
+         * @brief Deallocates storage obtained from allocate.
+         * @param ptr Pointer returned by allocate.
+         */
+        auto deallocate(T *ptr, const size_t) noexcept -> void
+        {
+            ::operator delete(ptr, std::align_val_t{Alignment});
+        }
+
+        /// @brief All instances are interchangeable.
+        template <typename U>
+        constexpr auto operator == (const AlignedAllocator<U, Alignment>&) const noexcept -> bool { return true; }
+    };
+}
@@ -1,9 +1,19 @@
 #pragma once
 
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "Mat4.hpp"
 #include "Vec3.hpp"
 #include "ReferenceFrame.hpp"
 #include "Recorder.hpp"
+#include "Reconstruction.hpp"
+#include "KMLLod.hpp"
+#include "DriftTelemetry.hpp"
+#include "Memory.hpp"
+#include "PerfCounters.hpp"
+#include "Trace.hpp"
 
 /**
  * @namespace FlightPath
@@ -11,6 +21,28 @@
  */
 namespace FlightPath
 {
+    /**
+     * @struct ApplicationSettings
+     * @brief Input, output and export options of an Application run.
+     */
+    struct ApplicationSettings
+    {
+        std::string input_path    = "./data/Graz-Gleichenberg.txt"; ///< Flight data file to read.
+        std::string kml_path      = "./data/Graz-Gleichenberg.kml"; ///< KML file to write.
+        double      kml_tolerance = 5.0;   ///< Maximum deviation of the exported tracks in meters.
+        bool        retain_output = false; ///< Keep the reconstructed entries in the recorder (not needed for the export).
+        std::string lod_directory;         ///< Directory for an additional tiled level of detail export, empty to disable (retains the output).
+        LodSettings lod_settings;          ///< Tiles and levels of the level of detail export.
+        std::string columnar_path;         ///< Binary columnar export of the full resolution result, empty to disable (retains the output).
+        std::string store_path;            ///< Memory-mapped TrajectoryStore other processes can read during the run, empty to disable.
+        std::string diagnostics_path;      ///< Binary per-step diagnostics log (see BinaryLog), empty to disable.
+        std::string profile_path;          ///< JSON report of the phase timings (requires ENABLE_PROFILING, see Profiler), empty to disable.
+        bool        perf_counters = false; ///< Count hardware events of read, integrate and export (Linux only, see PerfCounters).
+        std::string trace_path;            ///< Chrome trace-event JSON of the spans of all threads (see Trace), written at the end of Run, empty to disable.
+        size_t      drift_sample_interval = 0; ///< Record numerical drift every n-th step (see DriftTelemetry), 0 to disable.
+        bool        memory_report = false; ///< Report the memory footprint of read, integrate and export (see MemoryPhase).
+    };
+
     /**
      * @class Application
      * @brief Main application class responsible for reconstruction of the flight path based on body fixed accelerations and velocities.
@@ -18,24 +50,65 @@ namespace FlightPath
     class Application
     {
     public:
-        /// @brief Default constructor. Reads a default flight data file and initialized the reference frame and body frame velocity vectors
-        Application();
+        /**
+         * @brief Reads the flight data file and initializes the reference frame and body frame velocity vectors.
+         * @param settings Input, output and export options (defaults to the bundled Graz-Gleichenberg flight).
+         */
+        explicit Application(const ApplicationSettings &settings = {});
         
         /// @brief Default destructor.
         ~Application() = default;
 
-        /// @brief Runs the main function for reconstructing the flight path
+        /// @brief Runs the main function for reconstructing the flight path, the KML file is written while the flight is reconstructed
         auto Run() -> void;
 
+        /**
+         * @brief Returns the recorder holding the input (and optionally the reconstructed) flight data.
+         * @return A const reference to the recorder.
+         */
+        auto GetRecorder() const -> const Recorder& { return recorder_; }
+
+        /**
+         * @brief Returns the hardware event counts of the phases read, integrate and export.
+         * @return One entry per finished phase, empty unless perf_counters is set and the counters are available.
+         */
+        auto GetPerfReport() const -> const std::vector<PerfPhase>& { return perf_report_; }
+
+        /**
+         * @brief Returns the memory footprint of the phases read, integrate and export.
+         * @return One entry per finished phase, empty unless memory_report is set.
+         */
+        auto GetMemoryReport() const -> const std::vector<MemoryPhase>& { return memory_report_; }
+
+        /**
+         * @brief Returns the numerical drift collected during Run.
+         * @return The telemetry, empty unless drift_sample_interval is set.
+         */
+        auto GetDriftTelemetry() const -> const std::optional<DriftTelemetry>& { return drift_; }
+
     private:
+        /// @brief Starts measuring the memory footprint of a phase, if enabled.
+        auto BeginMemoryPhase() -> void;
+
+        /**
+         * @brief Adds the memory footprint since BeginMemoryPhase to the report, if enabled.
+         * @param name    Name of the phase.
+         * @param samples Number of flight data samples processed in the phase.
+         */
+        auto EndMemoryPhase(const std::string &name, const size_t samples) -> void;
 
     private:
 
-        ReferenceFrame reference_frame_; ///< Reference frame used for flight data calculations.
+        ApplicationSettings settings_;   ///< Input, output and export options.
+        Reconstructor reconstructor_;    ///< Reference frame and body-frame velocity of the reconstruction.
         Recorder recorder_;              ///< Recorder used to read and store flight data.
-        
-        Vec3<double> vb_n_{0,0,0};       ///< Body-frame velocity vector at time step n   in the navigation frame.
-        Vec3<double> vb_np1_{0,0,0};     ///< Body-frame velocity vector at time step n+1 in the navigation frame.
+
+        std::optional<PerfCounters> perf_counters_; ///< Hardware event counters, only if enabled and available.
+        std::vector<PerfPhase>      perf_report_;   ///< Event counts of the finished phases.
+        std::optional<DriftTelemetry> drift_;       ///< Numerical drift of the reconstruction, only if enabled.
+        std::vector<MemoryPhase>    memory_report_; ///< Memory footprint of the finished phases.
+        bool                        resident_reset_ = false; ///< True if the peak resident set size was reset at the begin of the current phase.
+        std::optional<Trace::Session> trace_session_; ///< Open trace session, only if enabled, closed at the end of Run or on destruction.
     };
 
 }
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace FlightPath::BinaryLog
+ * @brief Structured binary log for high-rate diagnostics, formatted offline.
+ *
+ * A call site records the id of its format string and the raw bytes of its arguments into a
+ * buffer of the calling thread; no text is formatted while the program runs. Full buffers
+ * are appended to the log file. Decode (or the FlightPathLogDecoder tool) renders the file as
+ * text or CSV afterwards.
+ *
+ * File layout (native byte order, checked by the decoder):
+ * - Header: magic "FPBINLOG", version (u32), byte order mark 0x01020304 (u32).
+ * - Chunks, each starting with a ChunkType byte:
+ *   - Format: id (u32), argument count (u8), one ArgType (u8) per argument, length (u32), format string.
+ *   - Records: thread index (u32), size (u32), records. A record is the format id (u32)
+ *     followed by one 8 byte value per argument.
+ *
+ * Usage:
+ * @code
+ * BinaryLog::Open("diagnostics.fpbl");
+ * BinaryLog::Write<"dt={:.4f} |vb|={:.3f}">(dt, speed);
+ * BinaryLog::Close();
+ * @endcode
+ */
+namespace FlightPath::BinaryLog
+{
+    /// @brief Identifies a FlightPath binary log file.
+    inline constexpr std::array<char, 8> Magic = {'F', 'P', 'B', 'I', 'N', 'L', 'O', 'G'};
+
+    /// @brief Current version of the file format.
+    inline constexpr uint32_t Version = 1;
+
+    /// @brief Size of the buffer of every thread in bytes.
+    inline constexpr size_t BufferSize = 64 * 1024;
+
+    /// @brief Kinds of chunks in a log file.
+    enum class ChunkType : uint8_t
+    {
+        Format  = 1, ///< Definition of a format string.
+        Records = 2, ///< Records of one thread.
+    };
+
+    /// @brief Stored type of an argument, every value occupies 8 bytes.
+    enum class ArgType : uint8_t
+    {
+        Int64   = 1, ///< Signed integers.
+        UInt64  = 2, ///< Unsigned integers.
+        Float64 = 3, ///< Floating point values.
+        Bool    = 4, ///< Booleans (stored as UInt64).
+    };
+
+    /// @brief Types that can be recorded.
+    template <typename T>
+    concept Loggable = std::is_arithmetic_v<std::remove_cvref_t<T>>;
+
+    /**
+     * @struct FixedString
+     * @brief A string literal usable as template argument.
+     * @tparam N Size of the literal including the terminating zero.
+     */
+    template <size_t N>
+    struct FixedString
+    {
+        char data[N]{};
+
+        /// @brief Copies the literal.
+        consteval FixedString(const char (&string)[N])
+        {
+            for (size_t i = 0; i < N; ++i) data[i] = string[i];
+        }
+
+        /// @brief Returns the string without the terminating zero.
+        constexpr auto View() const -> std::string_view { return {data, N - 1}; }
+    };
+
+    /**
+     * @brief Starts a log session.
+     * @param path Path of the log file, replaced if it exists.
+     * @throws FlightPath::Exception if a session is already open or the file can not be created.
+     */
+    auto Open(const std::string &path) -> void;
+
+    /**
+     * @brief Writes the buffers of all threads and ends the session.
+     *
+     * Must not be called while other threads still record (e.g. join them first). Does nothing
+     * if no session is open.
+     *
+     * @throws FlightPath::Exception if the file can not be written.
+     */
+    auto Close() -> void;
+
+    /**
+     * @brief Registers a format string, called once per call site.
+     * @param format The format string (std::format syntax, automatic argument indices only).
+     * @param types  The stored types of the arguments.
+     * @return The id of the format string.
+     */
+    auto Register(const std::string_view format, const std::span<const ArgType> types) -> uint32_t;
+
+    /// @brief Rendering of Decode.
+    enum class Output
+    {
+        Text, ///< One formatted line per record, prefixed with the thread index.
+        CSV,  ///< One row per record: thread, format id, format string, then the raw values.
+    };
+
+    /**
+     * @brief Renders a log file.
+     * @param path   Path of the log file.
+     * @param output Stream to write to.
+     * @param format Text or CSV.
+     * @return The number of records.
+     * @throws FlightPath::Exception if the file can not be read or is invalid.
+     */
+    auto Decode(const std::string &path, std::ostream &output, const Output format) -> size_t;
+
+    namespace Detail
+    {
+        /// @brief True while a session is open, checked before anything else is done.
+        inline std::atomic<bool> enabled{false};
+
+        /// @brief Free space in the buffer of a thread.
+        struct ThreadCursor
+        {
+            std::byte *position = nullptr; ///< Where the next record is written.
+            std::byte *end      = nullptr; ///< End of the buffer.
+        };
+
+        /// @brief Free space in the buffer of the calling thread, empty until its first record.
+        inline thread_local ThreadCursor cursor;
+
+        /**
+         * @brief Makes room for a record in the buffer of the calling thread.
+         *
+         * Allocates the buffer on first use and appends a full buffer to the file.
+         *
+         * @param size Size of the record in bytes.
+         */
+        auto Reserve(const size_t size) -> void;
+
+        template <typename T>
+        constexpr auto GetArgType() -> ArgType
+        {
+            using U = std::remove_cvref_t<T>;
+            if      constexpr (std::is_same_v<U, bool>)     return ArgType::Bool;
+            else if constexpr (std::is_floating_point_v<U>) return ArgType::Float64;
+            else if constexpr (std::is_signed_v<U>)         return ArgType::Int64;
+            else                                            return ArgType::UInt64;
+        }
+
+        // widens a value to its 8 byte stored representation
+        template <typename T>
+        inline auto Store(std::byte *destination, const T value) -> void
+        {
+            if      constexpr (GetArgType<T>() == ArgType::Float64) { const double   v = static_cast<double>(value);   std::memcpy(destination, &v, 8); }
+            else if constexpr (GetArgType<T>() == ArgType::Int64)   { const int64_t  v = static_cast<int64_t>(value);  std::memcpy(destination, &v, 8); }
+            else                                                    { const uint64_t v = static_cast<uint64_t>(value); std::memcpy(destination, &v, 8); }
+        }
+    }
+
+    /**
+     * @brief Records the arguments for a format string, formatted later by Decode.
+     *
+     * Costs a branch if no session is open, otherwise a copy of 4 + 8 * sizeof...(Args) bytes
+     * into the buffer of the calling thread.
+     *
+     * @tparam Format The format string (std::format syntax).
+     * @param  args   Arithmetic values.
+     */
+    template <FixedString Format, Loggable... Args>
+    inline auto Write(const Args... args) -> void
+    {
+        // checks the format string against the arguments at compile time
+        [[maybe_unused]] const std::format_string<Args...> checked(Format.View());
+
+        if (!Detail::enabled.load(std::memory_order_relaxed)) return;
+
+        static constexpr std::array<ArgType, sizeof...(Args)> types = {Detail::GetArgType<Args>()...};
+        static const uint32_t id = Register(Format.View(), types);
+
+        constexpr size_t size = sizeof(uint32_t) + 8 * sizeof...(Args);
+        auto &cursor = Detail::cursor;
+        if (static_cast<size_t>(cursor.end - cursor.position) < size) [[unlikely]]
+        {
+            Detail::Reserve(size);
+        }
+
+        std::byte *record = cursor.position;
+        std::memcpy(record, &id, sizeof(id));
+        size_t offset = sizeof(uint32_t);
+        ((Detail::Store(record + offset, args), offset += 8), ...);
+        (void)offset;
+        cursor.position += size;
+    }
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "AlignedAllocator.hpp"
+#include "Recorder.hpp"
+
+/**
+ * @namespace FlightPath::Columnar
+ * @brief Self-describing binary column format for full resolution flight data.
+ *
+ * File layout (all integers and values little-endian):
+ * - Header (64 bytes) with magic, version, number of columns, rows and allocated rows per column.
+ * - Schema: one ColumnDescriptor (64 bytes) per column with name, unit, type and offset.
+ * - Data: one block of `capacity` values per column, every block starts on a 64 byte boundary.
+ *
+ * Because every column is aligned and contiguous, a file can be memory-mapped and its columns
+ * used in place (e.g. as std::span<const double> or numpy.memmap) without parsing.
+ */
+namespace FlightPath::Columnar
+{
+    /// @brief Alignment of the header, the schema and every column block in bytes.
+    inline constexpr size_t Alignment = 64;
+
+    /// @brief Identifies a FlightPath columnar file.
+    inline constexpr std::array<char, 8> Magic = {'F', 'P', 'C', 'O', 'L', 'U', 'M', 'N'};
+
+    /// @brief Current version of the file format.
+    inline constexpr uint32_t Version = 1;
+
+    /// @brief Element types of a column.
+    enum class ColumnType : uint32_t
+    {
+        Float64 = 1, ///< IEEE 754 double precision.
+    };
+
+    /**
+     * @struct Header
+     * @brief The first 64 bytes of a columnar file.
+     */
+    struct alignas(Alignment) Header
+    {
+        std::array<char, 8> magic;  ///< Always Magic.
+        uint32_t version;           ///< File format version.
+        uint32_t column_count;      ///< Number of ColumnDescriptor entries in the schema.
+        uint64_t row_count;         ///< Number of valid rows in every column.
+        uint64_t capacity;          ///< Number of allocated rows in every column (row_count <= capacity).
+        uint64_t schema_offset;     ///< Byte offset of the first ColumnDescriptor.
+        uint64_t data_offset;       ///< Byte offset of the first column block.
+        uint64_t file_size;         ///< Total size of the file in bytes.
+        uint64_t reserved;          ///< Unused, zero.
+    };
+
+    /**
+     * @struct ColumnDescriptor
+     * @brief Schema entry describing one column.
+     */
+    struct alignas(Alignment) ColumnDescriptor
+    {
+        std::array<char, 32> name;  ///< Zero-terminated field name (e.g. "longitude").
+        std::array<char, 16> unit;  ///< Zero-terminated SI unit (e.g. "rad").
+        ColumnType type;            ///< Element type.
+        uint32_t   element_size;    ///< Size of one element in bytes.
+        uint64_t   offset;          ///< Byte offset of the column block.
+    };
+
+    static_assert(sizeof(Header) == 64 && sizeof(ColumnDescriptor) == 64, "Columnar: Unexpected layout");
+
+    /**
+     * @struct Field
+     * @brief Maps a member of Entry to a column.
+     */
+    struct Field
+    {
+        std::string_view name;   ///< Column name.
+        std::string_view unit;   ///< SI unit of the stored values.
+        double Entry::*member;   ///< The member of Entry holding the value.
+    };
+
+    /**
+     * @brief Returns the columns used for Entry data, in file order.
+     * @return One Field per member of Entry.
+     */
+    auto GetEntryFields() -> std::span<const Field>;
+
+    /**
+     * @brief Returns the size of a file for Entry data.
+     * @param capacity Number of rows to allocate per column.
+     * @return The file size in bytes.
+     */
+    auto GetEntryFileSize(const uint64_t capacity) -> uint64_t;
+
+    /**
+     * @brief Writes header and schema of a file for Entry data (in native byte order).
+     *
+     * Afterwards data holds a complete file with row_count = 0. The column blocks are not
+     * touched and are expected to be zero-initialized already.
+     *
+     * @param data     Memory of at least GetEntryFileSize(capacity) bytes, aligned to Alignment.
+     * @param capacity Number of rows to allocate per column.
+     * @throws FlightPath::Exception if data is too small.
+     */
+    auto InitializeEntryFile(const std::span<std::byte> data, const uint64_t capacity) -> void;
+
+    /**
+     * @brief Returns the column block of a field in a validated file.
+     * @param data The file contents.
+     * @param name The column name (e.g. "altitude").
+     * @return Pointer to the first value, the block holds header.capacity values.
+     * @throws FlightPath::Exception if there is no column of that name.
+     */
+    auto FindColumn(const std::span<const std::byte> data, const std::string_view name) -> const double*;
+
+    /**
+     * @brief Checks header and schema of a mapped or loaded file.
+     * @param data The file contents.
+     * @throws FlightPath::Exception if the file is truncated, not a columnar file or has an unsupported version.
+     */
+    auto Validate(const std::span<const std::byte> data) -> void;
+
+    /**
+     * @brief Writes entries as a columnar file with a single write.
+     * @param path    Path of the output file.
+     * @param entries The entries to export.
+     * @throws FlightPath::Exception if the file can not be written.
+     */
+    auto Write(const std::string &path, const std::span<const Entry> entries) -> void;
+
+    /**
+     * @class Reader
+     * @brief Loads a columnar file and provides its columns as spans.
+     */
+    class Reader
+    {
+    public:
+        /**
+         * @brief Reads and validates a columnar file.
+         * @param path Path of the file.
+         * @throws FlightPath::Exception if the file can not be read or is invalid.
+         */
+        explicit Reader(const std::string &path);
+
+        /// @brief Default destructor.
+        ~Reader() = default;
+
+        /// @brief Returns the file header.
+        auto GetHeader() const -> const Header& { return *reinterpret_cast<const Header*>(data_.data()); }
+
+        /// @brief Returns the schema, one descriptor per column.
+        auto GetSchema() const -> std::span<const ColumnDescriptor>;
+
+        /**
+         * @brief Returns the valid rows of a column.
+         * @param name The column name (e.g. "altitude").
+         * @return The values of the column.
+         * @throws FlightPath::Exception if there is no column of that name.
+         */
+        auto GetColumn(const std::string_view name) const -> std::span<const double>;
+
+        /**
+         * @brief Reassembles the rows into entries.
+         * @return One Entry per row.
+         */
+        auto GetEntries() const -> std::vector<Entry>;
+
+    private:
+        std::vector<std::byte, AlignedAllocator<std::byte, Alignment>> data_; ///< The complete file.
+    };
+}
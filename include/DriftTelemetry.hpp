@@ -0,0 +1,183 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+#include "ReferenceFrame.hpp"
+#include "Types.hpp"
+
+namespace FlightPath
+{
+    /**
+     * @class LogHistogram
+     * @brief Histogram with a fixed number of logarithmic bins between two bounds.
+     *
+     * Values below the lower bound (including zero) are counted in the first bin, values above
+     * the upper bound in the last one.
+     */
+    class LogHistogram
+    {
+    public:
+        /**
+         * @brief Creates an empty histogram.
+         * @param min             Lower bound of the second bin (> 0).
+         * @param max             Upper bound of the second to last bin (> min).
+         * @param bins_per_decade Number of bins per factor of 10.
+         * @throws FlightPath::Exception if the bounds are invalid.
+         */
+        LogHistogram(const double min, const double max, const size_t bins_per_decade);
+
+        /**
+         * @brief Counts a value.
+         * @param value The value.
+         */
+        auto Add(const double value) -> void;
+
+        /// @brief Returns the count of every bin, including the underflow and overflow bin.
+        auto GetCounts() const -> const std::vector<uint64_t>& { return counts_; }
+
+        /**
+         * @brief Returns the lower bound of a bin.
+         * @param bin The bin index.
+         * @return The bound, 0 for the underflow bin.
+         */
+        auto GetLowerBound(const size_t bin) const -> double;
+
+        /// @brief Returns the number of counted values.
+        auto GetTotal() const -> uint64_t { return total_; }
+
+        /**
+         * @brief Returns a percentile estimated from the bins.
+         * @param percentile The percentile in [0, 100].
+         * @return The upper bound of the bin holding the percentile, 0 if there are no values.
+         */
+        auto GetPercentile(const double percentile) const -> double;
+
+    private:
+        double   log_min_;              ///< log10 of the lower bound.
+        double   bins_per_decade_;      ///< Bins per factor of 10.
+        std::vector<uint64_t> counts_;  ///< Underflow bin, regular bins, overflow bin.
+        uint64_t total_ = 0;            ///< Number of counted values.
+    };
+
+    /**
+     * @struct DriftSample
+     * @brief Numerical state of one sampled integration step.
+     */
+    struct DriftSample
+    {
+        double orthogonal_error; ///< RMS orthogonality error of the rotation before Orthonormalize.
+        double length_error;     ///< RMS axis length error of the rotation before Orthonormalize.
+        double dt;               ///< Time step in s.
+        double divergence;       ///< Distance between the reconstructed and the logged position in m.
+    };
+
+    /**
+     * @struct DriftStatistic
+     * @brief Minimum, maximum and mean of a sampled quantity plus its histogram.
+     */
+    struct DriftStatistic
+    {
+        double       min  = 0.0;   ///< Smallest sampled value.
+        double       max  = 0.0;   ///< Largest sampled value.
+        double       sum  = 0.0;   ///< Sum of all sampled values.
+        LogHistogram histogram;    ///< Distribution of the sampled values.
+
+        /// @brief Counts a value.
+        auto Add(const double value) -> void;
+
+        /// @brief Returns the mean, 0 if nothing was sampled.
+        auto GetMean() const -> double;
+    };
+
+    /**
+     * @class DriftTelemetry
+     * @brief Collects the numerical drift of a reconstruction at a fixed sampling interval.
+     *
+     * Every step adds the iteration count of ReferenceFrame::Orthonormalize (an integer add),
+     * every sample_interval-th step additionally records a DriftSample, which costs two error
+     * evaluations and a position conversion. Bins and bounds are fixed, so the memory does not
+     * grow with the length of the flight.
+     */
+    class DriftTelemetry
+    {
+    public:
+        /**
+         * @brief Creates an empty telemetry.
+         * @param sample_interval Every how many steps a DriftSample is recorded (>= 1).
+         * @throws FlightPath::Exception if sample_interval is zero.
+         */
+        explicit DriftTelemetry(const size_t sample_interval);
+
+        /**
+         * @brief Tells whether the current step is to be sampled, call once per step.
+         * @return True every sample_interval-th call, starting with the first.
+         */
+        auto ShouldSample() -> bool
+        {
+            if (--countdown_ > 0) return false;
+            countdown_ = sample_interval_;
+            return true;
+        }
+
+        /**
+         * @brief Counts the Orthonormalize iterations of a step, call once per step.
+         * @param iterations The return value of ReferenceFrame::Orthonormalize.
+         */
+        auto AddIterations(const i32 iterations) -> void
+        {
+            ++steps_;
+            ++iterations_[static_cast<size_t>(iterations)];
+        }
+
+        /**
+         * @brief Records a sampled step (see ShouldSample).
+         * @param sample The numerical state of the step.
+         */
+        auto Add(const DriftSample &sample) -> void;
+
+        /// @brief Returns the number of steps.
+        auto GetSteps() const -> uint64_t { return steps_; }
+
+        /// @brief Returns the number of sampled steps.
+        auto GetSamples() const -> uint64_t { return samples_; }
+
+        /// @brief Returns the number of steps per Orthonormalize iteration count (index = iterations).
+        auto GetIterations() const -> const std::array<uint64_t, ReferenceFrame::MaxOrthonormalizeIterations + 1>& { return iterations_; }
+
+        /// @brief Returns the mean number of Orthonormalize iterations per step.
+        auto GetMeanIterations() const -> double;
+
+        /// @brief Returns the sampled orthogonality errors.
+        auto GetOrthogonalError() const -> const DriftStatistic& { return orthogonal_error_; }
+
+        /// @brief Returns the sampled axis length errors.
+        auto GetLengthError() const -> const DriftStatistic& { return length_error_; }
+
+        /// @brief Returns the sampled time steps in s.
+        auto GetTimeStep() const -> const DriftStatistic& { return dt_; }
+
+        /// @brief Returns the sampled distances between reconstructed and logged position in m.
+        auto GetDivergence() const -> const DriftStatistic& { return divergence_; }
+
+        /**
+         * @brief Writes the per-flight summary: iteration counts, min/mean/p99/max of every quantity and their histograms.
+         * @param output Stream to write to.
+         */
+        auto WriteSummary(std::ostream &output) const -> void;
+
+    private:
+        uint64_t sample_interval_; ///< Steps between two samples.
+        uint64_t countdown_ = 1;   ///< Steps until the next sample, the first step is sampled.
+        uint64_t steps_     = 0;   ///< Number of steps.
+        uint64_t samples_   = 0;   ///< Number of sampled steps.
+        std::array<uint64_t, ReferenceFrame::MaxOrthonormalizeIterations + 1> iterations_{}; ///< Steps per iteration count.
+
+        DriftStatistic orthogonal_error_; ///< Before Orthonormalize.
+        DriftStatistic length_error_;     ///< Before Orthonormalize.
+        DriftStatistic dt_;               ///< Time steps.
+        DriftStatistic divergence_;       ///< Distance to the logged position.
+    };
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace FlightPath
+{
+    /**
+     * @brief Describes the result type of an expression.
+     *
+     * Specialized for every type that can take part in a lazily evaluated expression
+     * (the value type Mat4 and the expression nodes below). Each specialization
+     * provides a `result_type` alias to the value type the expression evaluates to.
+     *
+     * @tparam T The type to describe.
+     */
+    template <typename T>
+    struct ExpressionTraits {};
+
+    /// @brief Satisfied by value types and expression nodes that can be evaluated element-wise.
+    template <typename T>
+    concept Expression = requires { typename ExpressionTraits<std::remove_cvref_t<T>>::result_type; };
+
+    /// @brief The value type (e.g. Mat4<double>) an expression evaluates to.
+    template <Expression T>
+    using ExpressionResult = typename ExpressionTraits<std::remove_cvref_t<T>>::result_type;
+
+    /// @brief The scalar type (e.g. double) of the elements of an expression.
+    template <Expression T>
+    using ExpressionScalar = typename ExpressionResult<T>::value_type;
+
+    /**
+     * @brief Storage of an operand inside an expression node.
+     *
+     * Named operands (lvalues) are referenced to avoid copies, temporaries are moved
+     * into the node so that the expression never refers to a destroyed object.
+     */
+    template <typename T>
+    using ExpressionOperand = std::conditional_t<
+        std::is_lvalue_reference_v<T>,
+        const std::remove_reference_t<T>&,
+        std::remove_cvref_t<T>
+    >;
+
+    /**
+     * @brief Lazily evaluated element-wise operation of two expressions.
+     *
+     * Nothing is computed when the node is created. Every element is evaluated on demand
+     * via Eval, so a chain like `a + b * s` is evaluated in a single loop when it is
+     * converted (or assigned) to its result type.
+     *
+     * @tparam L  Type of the left-hand side operand.
+     * @tparam R  Type of the right-hand side operand.
+     * @tparam Op Binary function object applied to each element pair.
+     */
+    template <typename L, typename R, typename Op>
+    struct BinaryExpression
+    {
+        ExpressionOperand<L> lhs; ///< Left-hand side operand.
+        ExpressionOperand<R> rhs; ///< Right-hand side operand.
+
+        /**
+         * @brief Evaluates a single element of the expression.
+         * @param index Linear index of the element.
+         * @return The value of the element.
+         */
+        constexpr auto inline Eval(const size_t index) const -> ExpressionScalar<L>
+        {
+            return Op{}(lhs.Eval(index), rhs.Eval(index));
+        }
+
+        /**
+         * @brief Evaluates all elements into the result type, e.g. `(A + B).Evaluate().GetColumn(3)`.
+         * @return The evaluated value.
+         */
+        constexpr auto inline Evaluate() const -> ExpressionResult<L>
+        {
+            return ExpressionResult<L>::Evaluate(*this);
+        }
+
+        /// @brief Evaluates all elements into the result type.
+        constexpr inline operator ExpressionResult<L>() const
+        {
+            return ExpressionResult<L>::Evaluate(*this);
+        }
+    };
+
+    /**
+     * @brief Lazily evaluated multiplication of an expression with a scalar.
+     * @tparam E Type of the scaled operand.
+     */
+    template <typename E>
+    struct ScaledExpression
+    {
+        ExpressionOperand<E> expr;   ///< The scaled operand.
+        ExpressionScalar<E>  scalar; ///< The scale factor.
+
+        /**
+         * @brief Evaluates a single element of the expression.
+         * @param index Linear index of the element.
+         * @return The value of the element.
+         */
+        constexpr auto inline Eval(const size_t index) const -> ExpressionScalar<E>
+        {
+            return expr.Eval(index) * scalar;
+        }
+
+        /**
+         * @brief Evaluates all elements into the result type, e.g. `(A + B).Evaluate().GetColumn(3)`.
+         * @return The evaluated value.
+         */
+        constexpr auto inline Evaluate() const -> ExpressionResult<E>
+        {
+            return ExpressionResult<E>::Evaluate(*this);
+        }
+
+        /// @brief Evaluates all elements into the result type.
+        constexpr inline operator ExpressionResult<E>() const
+        {
+            return ExpressionResult<E>::Evaluate(*this);
+        }
+    };
+
+    /// @brief Expression nodes evaluate to the result type of their (left) operand.
+    template <typename L, typename R, typename Op>
+    struct ExpressionTraits<BinaryExpression<L, R, Op>> { using result_type = ExpressionResult<L>; };
+
+    /// @brief Expression nodes evaluate to the result type of their operand.
+    template <typename E>
+    struct ExpressionTraits<ScaledExpression<E>> { using result_type = ExpressionResult<E>; };
+
+    /**
+     * @brief Element-wise addition of two expressions of the same result type.
+     * @param lhs The left-hand side operand.
+     * @param rhs The right-hand side operand.
+     * @return An unevaluated expression node.
+     */
+    template <Expression L, Expression R>
+        requires std::is_same_v<ExpressionResult<L>, ExpressionResult<R>>
+    constexpr auto inline operator + (L &&lhs, R &&rhs) -> BinaryExpression<L, R, std::plus<>>
+    {
+        return BinaryExpression<L, R, std::plus<>>{std::forward<L>(lhs), std::forward<R>(rhs)};
+    }
+
+    /**
+     * @brief Element-wise subtraction of two expressions of the same result type.
+     * @param lhs The left-hand side operand.
+     * @param rhs The right-hand side operand.
+     * @return An unevaluated expression node.
+     */
+    template <Expression L, Expression R>
+        requires std::is_same_v<ExpressionResult<L>, ExpressionResult<R>>
+    constexpr auto inline operator - (L &&lhs, R &&rhs) -> BinaryExpression<L, R, std::minus<>>
+    {
+        return BinaryExpression<L, R, std::minus<>>{std::forward<L>(lhs), std::forward<R>(rhs)};
+    }
+
+    /**
+     * @brief Multiplication of an expression with a scalar.
+     * @param expr   The expression to scale.
+     * @param scalar The scale factor.
+     * @return An unevaluated expression node.
+     */
+    template <Expression E>
+    constexpr auto inline operator * (E &&expr, const ExpressionScalar<E> scalar) -> ScaledExpression<E>
+    {
+        return ScaledExpression<E>{std::forward<E>(expr), scalar};
+    }
+
+    /**
+     * @brief Multiplication of a scalar with an expression.
+     * @param scalar The scale factor.
+     * @param expr   The expression to scale.
+     * @return An unevaluated expression node.
+     */
+    template <Expression E>
+    constexpr auto inline operator * (const ExpressionScalar<E> scalar, E &&expr) -> ScaledExpression<E>
+    {
+        return ScaledExpression<E>{std::forward<E>(expr), scalar};
+    }
+}
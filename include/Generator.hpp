@@ -0,0 +1,126 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+#if __has_include(<generator>)
+    #include <generator>
+#endif
+
+namespace FlightPath
+{
+#if defined(__cpp_lib_generator)
+    /// @brief Lazily computed sequence of values, std::generator where the standard library provides it.
+    template <typename T>
+    using Generator = std::generator<T>;
+#else
+    /**
+     * @class Generator
+     * @brief Minimal stand-in for std::generator<T> on standard libraries without it.
+     *
+     * A coroutine returning a Generator computes its next value only when the iterator is
+     * incremented, yielded values are not copied. It is a move-only input view, so it composes with
+     * range adaptors (e.g. std::views::take_while). Unlike std::generator it can not yield ranges
+     * (co_yield std::ranges::elements_of) and dereferences to const T& instead of T&&.
+     *
+     * @tparam T The yielded type.
+     */
+    template <typename T>
+    class Generator : public std::ranges::view_interface<Generator<T>>
+    {
+    public:
+        /// @brief Coroutine state of a Generator.
+        struct promise_type
+        {
+            const T           *value = nullptr; ///< The last yielded value, lives in the suspended coroutine.
+            std::exception_ptr exception;       ///< Exception thrown by the coroutine, rethrown by the iterator.
+
+            auto get_return_object() -> Generator { return Generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+            auto final_suspend() noexcept -> std::suspend_always { return {}; }
+            auto yield_value(const T &yielded) noexcept -> std::suspend_always { value = std::addressof(yielded); return {}; }
+            auto return_void() noexcept -> void {}
+            auto unhandled_exception() -> void { exception = std::current_exception(); }
+
+            /// @brief A generator only yields, it can not await.
+            template <typename U>
+            auto await_transform(U&&) -> std::suspend_never = delete;
+        };
+
+        /// @brief Input iterator resuming the coroutine on increment.
+        class Iterator
+        {
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type       = T;
+            using difference_type  = std::ptrdiff_t;
+
+            Iterator() = default;
+            explicit Iterator(const std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+            auto operator*() const -> const T& { return *handle_.promise().value; }
+
+            auto operator++() -> Iterator&
+            {
+                Resume(handle_);
+                return *this;
+            }
+
+            auto operator++(int) -> void { ++*this; }
+
+            friend auto operator==(const Iterator &iterator, std::default_sentinel_t) -> bool { return iterator.handle_.done(); }
+
+        private:
+            std::coroutine_handle<promise_type> handle_; ///< The coroutine, owned by the Generator.
+        };
+
+        Generator(Generator &&other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+        auto operator=(Generator &&other) noexcept -> Generator&
+        {
+            if (this != &other)
+            {
+                if (handle_) handle_.destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        /// @brief Destroys the coroutine, also if it did not run to its end.
+        ~Generator()
+        {
+            if (handle_) handle_.destroy();
+        }
+
+        /// @brief Runs the coroutine to its first value, call only once.
+        auto begin() -> Iterator
+        {
+            Resume(handle_);
+            return Iterator(handle_);
+        }
+
+        /// @brief Returns the sentinel, reached when the coroutine returns.
+        auto end() const noexcept -> std::default_sentinel_t { return std::default_sentinel; }
+
+    private:
+        explicit Generator(const std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+        // runs the coroutine to its next co_yield (or its end) and rethrows what it threw
+        static auto Resume(const std::coroutine_handle<promise_type> handle) -> void
+        {
+            handle.resume();
+            if (handle.promise().exception)
+            {
+                std::rethrow_exception(std::exchange(handle.promise().exception, {}));
+            }
+        }
+
+        std::coroutine_handle<promise_type> handle_; ///< The owned coroutine, empty after a move.
+    };
+#endif
+}
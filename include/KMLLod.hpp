@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Recorder.hpp"
+
+namespace FlightPath
+{
+    /**
+     * @struct LodLevel
+     * @brief One level of detail of a tiled KML export.
+     *
+     * A level becomes visible in Google Earth while the region of its tile covers between
+     * min_lod_pixels and max_lod_pixels on screen (see the KML `<Lod>` element).
+     */
+    struct LodLevel
+    {
+        double tolerance;      ///< Maximum deviation of the exported from the full track in meters.
+        double min_lod_pixels; ///< Minimum size of the region on screen in pixels.
+        double max_lod_pixels; ///< Maximum size of the region on screen in pixels (-1 for unlimited).
+    };
+
+    /**
+     * @struct LodSettings
+     * @brief Options of the tiled level of detail KML export.
+     */
+    struct LodSettings
+    {
+        size_t tile_size = 2048; ///< Number of entries per (temporal) tile.
+
+        /// @brief The levels from coarse to fine, their Lod ranges should not overlap.
+        std::vector<LodLevel> levels = {
+            {.tolerance = 25.0, .min_lod_pixels =   0.0, .max_lod_pixels = 512.0},
+            {.tolerance =  1.0, .min_lod_pixels = 512.0, .max_lod_pixels =  -1.0},
+        };
+
+        /// @brief Absolute time of Entry::time == 0, used for the time stamps of the tracks.
+        std::chrono::sys_seconds start_time{};
+    };
+
+    /**
+     * @brief Exports the original and reconstructed track as tiled KML with levels of detail.
+     *
+     * Both tracks are split into temporal tiles of settings.tile_size entries. Every tile is
+     * simplified for every level and written as a `gx:Track` with time stamps into its own file
+     * `<directory>/tiles/<track>_<tile>_<level>.kml`. The root document `<directory>/doc.kml`
+     * links all of them via `<NetworkLink>` with a `<Region>` around the tile, so Google Earth
+     * only loads the tiles in view and only at the needed level of detail. The tiles are
+     * generated in parallel.
+     *
+     * @param directory     Output directory, created if it does not exist.
+     * @param original      The original flight data.
+     * @param reconstructed The reconstructed flight data.
+     * @param settings      Tile size, levels of detail and start time.
+     * @throws FlightPath::Exception if the settings are invalid or a file can not be written.
+     */
+    auto ExportLodKML(const std::string &directory, const std::span<const Entry> original, const std::span<const Entry> reconstructed, const LodSettings &settings = {}) -> void;
+}
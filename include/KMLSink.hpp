@@ -0,0 +1,86 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "KMLWriter.hpp"
+#include "Recorder.hpp"
+#include "Simplify.hpp"
+
+namespace FlightPath
+{
+    /**
+     * @class KMLSink
+     * @brief Incremental KML export of flight tracks.
+     *
+     * Complete tracks (e.g. the input data) are written at once with WriteTrack. Tracks that are
+     * computed step by step are streamed with BeginTrack, Push and EndTrack, so the entries never
+     * have to be stored. Both are simplified to the given tolerance in meters (see SimplifyTrack
+     * and StreamingSimplifier).
+     *
+     * Usage:
+     * @code
+     * KMLSink sink(path, 5.0_m);
+     * sink.WriteTrack(KML::OpenOriginalDataset, recorder.GetData());
+     * sink.BeginTrack(KML::OpenReconstructedDataset);
+     * for (...) sink.Push(recorder.WriteData(...));
+     * sink.EndTrack();
+     * sink.Close();
+     * @endcode
+     */
+    class KMLSink
+    {
+    public:
+        /**
+         * @brief Opens the KML file and writes the document header.
+         * @param path      Path to the output KML file.
+         * @param tolerance Maximum deviation of the exported from the full tracks in meters.
+         * @throws FlightPath::Exception if the file can not be opened or tolerance is negative.
+         */
+        KMLSink(const std::string &path, const double tolerance);
+
+        /// @brief Default destructor. Call Close to finish the document.
+        ~KMLSink() = default;
+
+        KMLSink(const KMLSink&) = delete;
+        auto operator=(const KMLSink&) -> KMLSink& = delete;
+
+        /**
+         * @brief Writes a complete track.
+         * @param open    The opening KML fragment of the placemark (e.g. KML::OpenOriginalDataset).
+         * @param entries The entries of the track.
+         */
+        auto WriteTrack(const std::string_view open, const std::span<const Entry> entries) -> void;
+
+        /**
+         * @brief Starts a streamed track.
+         * @param open The opening KML fragment of the placemark (e.g. KML::OpenReconstructedDataset).
+         */
+        auto BeginTrack(const std::string_view open) -> void;
+
+        /**
+         * @brief Adds the next entry to the streamed track.
+         * @param entry The entry to add.
+         */
+        auto Push(const Entry &entry) -> void;
+
+        /**
+         * @brief Finishes the streamed track, its last entry is always exported.
+         */
+        auto EndTrack() -> void;
+
+        /**
+         * @brief Writes the document footer and flushes the file.
+         * @throws FlightPath::Exception if writing fails.
+         */
+        auto Close() -> void;
+
+    private:
+        KMLWriter           writer_;     ///< Buffered output file.
+        double              tolerance_;  ///< Maximum deviation in meters.
+        StreamingSimplifier simplifier_; ///< Decimation of the streamed track.
+        Entry               previous_{}; ///< The last pushed entry, exported once it is known to be a vertex.
+        size_t              count_ = 0;  ///< Number of entries pushed to the streamed track.
+    };
+}
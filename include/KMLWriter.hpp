@@ -0,0 +1,79 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace FlightPath
+{
+    /**
+     * @class KMLWriter
+     * @brief Buffered writer for KML files.
+     *
+     * Text and coordinates are collected in a large, reused buffer which is written to
+     * the file in blocks. Coordinates are formatted in-place with std::to_chars, so no
+     * temporary strings are created per line.
+     */
+    class KMLWriter
+    {
+    public:
+        /// @brief Default size of the output buffer in bytes.
+        static constexpr size_t DefaultBufferSize = 1 << 20;
+
+        /**
+         * @brief Opens (and truncates) the output file.
+         * @param path        Path to the KML file.
+         * @param buffer_size Size of the output buffer in bytes.
+         * @throws FlightPath::Exception if the file can not be opened.
+         */
+        explicit KMLWriter(const std::string &path, const size_t buffer_size = DefaultBufferSize);
+
+        /// @brief Writes the remaining buffer to the file.
+        ~KMLWriter();
+
+        KMLWriter(const KMLWriter&) = delete;
+        auto operator=(const KMLWriter&) -> KMLWriter& = delete;
+
+        /**
+         * @brief Appends raw text (e.g. one of the KML constants).
+         * @param text The text to append.
+         */
+        auto Write(const std::string_view text) -> void;
+
+        /**
+         * @brief Appends one line of a `<coordinates>` element.
+         *
+         * The line is indented by 12 spaces and formatted like
+         * `std::format("{:12.9f}, {:12.9f}, {:6.1f}\n", longitude, latitude, altitude)`.
+         *
+         * @param longitude Longitude in degrees.
+         * @param latitude  Latitude in degrees.
+         * @param altitude  Altitude in meters.
+         */
+        auto WriteCoordinate(const double longitude, const double latitude, const double altitude) -> void;
+
+        /**
+         * @brief Appends a number like `std::format("{:<width>.<precision>f}", value)`.
+         * @param value     The number to append.
+         * @param width     The minimum width, shorter numbers are padded with spaces on the left.
+         * @param precision The number of decimals (at most 9).
+         * @throws FlightPath::Exception if width exceeds the longest possible number (320 characters).
+         */
+        auto WriteFixed(const double value, const size_t width, const int precision) -> void;
+
+        /**
+         * @brief Writes the buffered data to the file.
+         * @throws FlightPath::Exception if writing fails.
+         */
+        auto Flush() -> void;
+
+    private:
+        std::string         path_;     ///< Path to the output file (for error messages).
+        std::ofstream       file_;     ///< The output file.
+        TrackedVector<char> buffer_;   ///< The output buffer, booked as transient memory.
+        size_t              size_ = 0; ///< Number of used bytes in the output buffer.
+    };
+}
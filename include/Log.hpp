@@ -1,13 +1,22 @@
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <format>
+#include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <source_location>
 
 #include "Exception.hpp"
 #include "Types.hpp"
 
+#ifndef FLIGHTPATH_LOG_LEVEL
+    /// @brief Minimum log level compiled into the program, set by the CMake cache variable of the same name.
+    #define FLIGHTPATH_LOG_LEVEL DEBUG
+#endif
+
 /**
  * @namespace AnsiColor
  * @brief Contains utilities for applying ANSI color codes to strings.
@@ -73,6 +82,40 @@ namespace FlightPath::Log
         ERROR   ///< Error messages indicating failures.
     };
 
+    /// @brief Messages below this level are removed at compile time (see FLIGHTPATH_LOG_LEVEL).
+    inline constexpr Level MinLevel = Level::FLIGHTPATH_LOG_LEVEL;
+
+    /// @brief True if messages of level L are compiled in.
+    template <Level L>
+    inline constexpr bool IsEnabled = L >= MinLevel;
+
+    /**
+     * @struct FormatString
+     * @brief A format string checked at compile time, together with the source location of the log call.
+     *
+     * Lets the formatting log functions take a variadic argument list and still capture the
+     * caller's location.
+     *
+     * @tparam Args The types of the format arguments.
+     */
+    template <typename... Args>
+    struct FormatString
+    {
+        std::format_string<Args...> format;   ///< The checked format string.
+        std::source_location        location; ///< The source location of the log call.
+
+        /**
+         * @brief Checks the format string against Args.
+         * @param string   The format string (e.g. a string literal).
+         * @param location The source location of the log call (defaults to caller location).
+         */
+        template <typename String>
+        consteval FormatString(const String &string, const std::source_location &location = std::source_location::current())
+            : format(string), location(location)
+        {
+        }
+    };
+
     /**
      * @brief Returns a colored prefix string for the specified log level.
      * 
@@ -90,8 +133,72 @@ namespace FlightPath::Log
         else { throw Exception(std::format("No colored prefix for Log::Level {} implemented.", static_cast<i32>(L))); }
     }
 
+    /**
+     * @brief Enables or disables the asynchronous backend.
+     *
+     * While enabled, log calls copy their message into a fixed-size record of a lock-free
+     * multi-producer queue and return; a background thread adds prefix and source location and
+     * writes the records to standard output in order. Messages longer than MaxAsyncMessageLength
+     * are truncated. Disabling (and the end of the program) writes all pending records first.
+     * Must not be called concurrently with log calls.
+     *
+     * @param enable True to start the background thread, false to stop it and log synchronously.
+     */
+    auto EnableAsync(const bool enable = true) -> void;
+
+    /// @brief Returns true while the asynchronous backend is enabled.
+    auto IsAsync() -> bool;
+
+    /// @brief Blocks until all messages logged before the call are written and flushes standard output.
+    auto Flush() -> void;
+
+    /// @brief Maximum length of a message in the asynchronous backend, longer messages are truncated.
+    inline constexpr size_t MaxAsyncMessageLength = 480;
+
+    namespace Detail
+    {
+        /**
+         * @brief Formats one line of log output.
+         * @tparam L The log level.
+         * @param message   The message to log.
+         * @param file_path The source file of the log call, only its file name is printed.
+         * @param line      The source line of the log call.
+         * @return The line including prefix, location (except for INFO) and newline.
+         */
+        template <Level L>
+        inline auto FormatMessage(std::string_view message, std::string_view file_path, const uint_least32_t line) -> std::string
+        {
+            std::string prefix = GetColoredPrefix<L>();
+
+            if constexpr (L == Level::INFO)
+            {
+                (void)file_path;
+                (void)line;
+                return std::format("{} {}\n", prefix, message);
+            }
+            else
+            {
+                // only use file name (without path)
+                std::string_view file = file_path;
+                size_t pos = file.find_last_of("/\\");
+                if (pos != std::string_view::npos)
+                {
+                    file.remove_prefix(pos + 1);
+                }
+
+                return std::format("{} {}:{} {}\n", prefix, file, line, message);
+            }
+        }
+
+        /// @brief Queues a message for the asynchronous backend (see EnableAsync).
+        auto Enqueue(const Level level, std::string_view message, const std::source_location &location) -> void;
+    }
+
     /**
      * @brief Logs a message to standard output with a prefix and optional source location.
+     *
+     * Writes synchronously unless the asynchronous backend is enabled (see EnableAsync).
+     * Compiles to nothing if L is below MinLevel.
      * 
      * @tparam L The log level.
      * @param message The message to log.
@@ -100,24 +207,20 @@ namespace FlightPath::Log
     template <Level L>
     inline auto LogMessage(std::string_view message, const std::source_location& location = std::source_location::current())
     {
-        std::string prefix = GetColoredPrefix<L>();
-
-        if constexpr (L == Level::INFO)
+        if constexpr (!IsEnabled<L>)
         {
-            std::cout << std::format("{} {}", prefix, message) << "\n";
+            (void)message;
+            (void)location;
+            return;
         }
-        else
-        {
-            // only use file name (without path)
-            std::string_view file = location.file_name();
-            size_t pos = file.find_last_of("/\\");
-            if (pos != std::string_view::npos)
-            {
-                file.remove_prefix(pos + 1);
-            }
 
-            std::cout << std::format("{} {}:{} {}", prefix, file, location.line(), message) << "\n";
+        if (IsAsync())
+        {
+            Detail::Enqueue(L, message, location);
+            return;
         }
+
+        std::cout << Detail::FormatMessage<L>(message, location.file_name(), location.line());
     }
 
     /**
@@ -131,6 +234,24 @@ namespace FlightPath::Log
         LogMessage<Level::DEBUG>(message, location);
     }
 
+    /**
+     * @brief Formats and logs a DEBUG-level message, the message is only formatted if DEBUG is compiled in.
+     *
+     * Below MinLevel the call, including the formatting of its arguments, compiles to nothing.
+     *
+     * @param format The format string, checked at compile time (captures the caller location).
+     * @param arg    The first format argument.
+     * @param args   The remaining format arguments.
+     */
+    template <typename Arg, typename... Args>
+    inline auto Debug(FormatString<std::type_identity_t<Arg>, std::type_identity_t<Args>...> format, Arg &&arg, Args&&... args) -> void
+    {
+        if constexpr (IsEnabled<Level::DEBUG>)
+        {
+            LogMessage<Level::DEBUG>(std::format(format.format, std::forward<Arg>(arg), std::forward<Args>(args)...), format.location);
+        }
+    }
+
     /**
      * @brief Logs an INFO-level message.
      * 
@@ -142,6 +263,24 @@ namespace FlightPath::Log
         LogMessage<Level::INFO>(message, location);
     }
 
+    /**
+     * @brief Formats and logs an INFO-level message, the message is only formatted if INFO is compiled in.
+     *
+     * Below MinLevel the call, including the formatting of its arguments, compiles to nothing.
+     *
+     * @param format The format string, checked at compile time (captures the caller location).
+     * @param arg    The first format argument.
+     * @param args   The remaining format arguments.
+     */
+    template <typename Arg, typename... Args>
+    inline auto Info(FormatString<std::type_identity_t<Arg>, std::type_identity_t<Args>...> format, Arg &&arg, Args&&... args) -> void
+    {
+        if constexpr (IsEnabled<Level::INFO>)
+        {
+            LogMessage<Level::INFO>(std::format(format.format, std::forward<Arg>(arg), std::forward<Args>(args)...), format.location);
+        }
+    }
+
     /**
      * @brief Logs a WARN-level message with optional source location.
      * 
@@ -153,6 +292,24 @@ namespace FlightPath::Log
         LogMessage<Level::WARN>(message, location);
     }
 
+    /**
+     * @brief Formats and logs a WARN-level message, the message is only formatted if WARN is compiled in.
+     *
+     * Below MinLevel the call, including the formatting of its arguments, compiles to nothing.
+     *
+     * @param format The format string, checked at compile time (captures the caller location).
+     * @param arg    The first format argument.
+     * @param args   The remaining format arguments.
+     */
+    template <typename Arg, typename... Args>
+    inline auto Warn(FormatString<std::type_identity_t<Arg>, std::type_identity_t<Args>...> format, Arg &&arg, Args&&... args) -> void
+    {
+        if constexpr (IsEnabled<Level::WARN>)
+        {
+            LogMessage<Level::WARN>(std::format(format.format, std::forward<Arg>(arg), std::forward<Args>(args)...), format.location);
+        }
+    }
+
     /**
      * @brief Logs an ERROR-level message with optional source location.
      * 
@@ -163,4 +320,22 @@ namespace FlightPath::Log
     {
         LogMessage<Level::ERROR>(message, location);
     }
+
+    /**
+     * @brief Formats and logs an ERROR-level message, the message is only formatted if ERROR is compiled in.
+     *
+     * Below MinLevel the call, including the formatting of its arguments, compiles to nothing.
+     *
+     * @param format The format string, checked at compile time (captures the caller location).
+     * @param arg    The first format argument.
+     * @param args   The remaining format arguments.
+     */
+    template <typename Arg, typename... Args>
+    inline auto Error(FormatString<std::type_identity_t<Arg>, std::type_identity_t<Args>...> format, Arg &&arg, Args&&... args) -> void
+    {
+        if constexpr (IsEnabled<Level::ERROR>)
+        {
+            LogMessage<Level::ERROR>(std::format(format.format, std::forward<Arg>(arg), std::forward<Args>(args)...), format.location);
+        }
+    }
 }
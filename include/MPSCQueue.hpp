@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace FlightPath
+{
+    /**
+     * @class MPSCQueue
+     * @brief Bounded lock-free queue for many producers and a single consumer.
+     *
+     * Based on Dmitry Vyukov's bounded queue: every cell carries a sequence number which tells
+     * producers whether the cell is free and the consumer whether it is filled. Producers claim
+     * a position with one compare-and-swap and never wait for each other while writing the value.
+     *
+     * @tparam T        Element type, default constructible and assignable.
+     * @tparam Capacity Number of cells, a power of two.
+     */
+    template <typename T, size_t Capacity>
+    class MPSCQueue
+    {
+        static_assert(std::has_single_bit(Capacity), "MPSCQueue: Capacity must be a power of two");
+
+    public:
+        /// @brief Allocates all cells.
+        MPSCQueue()
+            : cells_(std::make_unique<Cell[]>(Capacity))
+        {
+            for (size_t i = 0; i < Capacity; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        /// @brief Default destructor.
+        ~MPSCQueue() = default;
+
+        MPSCQueue(const MPSCQueue&) = delete;
+        auto operator=(const MPSCQueue&) -> MPSCQueue& = delete;
+
+        /**
+         * @brief Writes an element in place, safe to call from any number of threads.
+         * @param fill Callable taking T&, fills the claimed cell.
+         * @return False if the queue is full (fill is not called).
+         */
+        template <typename Fill>
+        auto TryPush(Fill &&fill) -> bool
+        {
+            size_t position = enqueue_position_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell &cell = cells_[position & (Capacity - 1)];
+                const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+                if (difference == 0)
+                {
+                    if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        fill(cell.value);
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = enqueue_position_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Removes the oldest element, must only be called by the consumer thread.
+         * @param consume Callable taking const T&, called with the element before its cell is released.
+         * @return False if the queue is empty.
+         */
+        template <typename Consume>
+        auto TryPop(Consume &&consume) -> bool
+        {
+            Cell &cell = cells_[dequeue_position_ & (Capacity - 1)];
+            if (cell.sequence.load(std::memory_order_acquire) != dequeue_position_ + 1)
+            {
+                return false;
+            }
+
+            consume(static_cast<const T&>(cell.value));
+            cell.sequence.store(dequeue_position_ + Capacity, std::memory_order_release);
+            ++dequeue_position_;
+            return true;
+        }
+
+    private:
+        struct alignas(64) Cell
+        {
+            std::atomic<size_t> sequence{0};
+            T value{};
+        };
+
+        std::unique_ptr<Cell[]> cells_;                            ///< The ring of cells.
+        alignas(64) std::atomic<size_t> enqueue_position_{0};      ///< Next position claimed by a producer.
+        alignas(64) size_t dequeue_position_ = 0;                  ///< Next position read by the consumer.
+    };
+}
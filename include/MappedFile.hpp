@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace FlightPath
+{
+    /**
+     * @class MappedFile
+     * @brief Memory mapping of a whole file (POSIX mmap or Win32 MapViewOfFile).
+     *
+     * The mapping is shared, so writes through a read-write mapping become visible to every other
+     * process mapping the same file without any copies.
+     */
+    class MappedFile
+    {
+    public:
+        /**
+         * @brief Creates (or truncates) a file of the given size, zero-filled, and maps it read-write.
+         * @param path Path of the file.
+         * @param size Size of the file in bytes.
+         * @throws FlightPath::Exception if the file can not be created or mapped.
+         */
+        MappedFile(const std::string &path, const size_t size);
+
+        /**
+         * @brief Maps an existing file read-only.
+         * @param path Path of the file.
+         * @throws FlightPath::Exception if the file can not be opened or mapped.
+         */
+        explicit MappedFile(const std::string &path);
+
+        /// @brief Unmaps and closes the file.
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+        MappedFile(MappedFile &&other) noexcept;
+        auto operator=(MappedFile &&other) noexcept -> MappedFile&;
+
+        /// @brief Returns the mapped bytes, only writable for a read-write mapping.
+        auto GetData() const -> std::span<std::byte> { return {data_, size_}; }
+
+        /// @brief Returns true if the mapping was created read-write.
+        auto IsWritable() const -> bool { return writable_; }
+
+        /**
+         * @brief Writes modified pages back to the file (blocking), not needed for other processes to see them.
+         * @throws FlightPath::Exception if the pages can not be written.
+         */
+        auto Sync() const -> void;
+
+    private:
+        auto Close() noexcept -> void;
+
+    private:
+        std::byte *data_     = nullptr; ///< Start of the mapping.
+        size_t     size_     = 0;       ///< Size of the mapping in bytes.
+        bool       writable_ = false;   ///< Mapped read-write.
+#ifdef _WIN32
+        void      *file_     = nullptr; ///< File handle.
+        void      *mapping_  = nullptr; ///< File mapping handle.
+#else
+        int        file_     = -1;      ///< File descriptor.
+#endif
+    };
+}
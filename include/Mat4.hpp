@@ -1,10 +1,14 @@
 #pragma once
 
 #include <array>
+#include <algorithm>
+#include <concepts>
 #include <iostream>
 #include <format>
+#include <type_traits>
 
-#include "Error.hpp"
+#include "Expression.hpp"
+#include "Mat4Kernels.hpp"
 #include "Types.hpp"
 #include "Vec3.hpp"
 
@@ -16,6 +20,9 @@ namespace FlightPath
      * This class provides basic functionality for manipulating 4x4 matrices,
      * including addition, subtraction, scalar multiplication, and matrix multiplication.
      * It supports column operations and provides access to raw data.
+     *
+     * Addition, subtraction and scaling build lazily evaluated expressions (see Expression.hpp),
+     * so a chain like `eye + twist * dt` is evaluated in a single loop without temporary matrices.
      * 
      * @tparam REAL Floating-point type (e.g., float or double)
      */
@@ -23,33 +30,105 @@ namespace FlightPath
     class Mat4
     {
     public:
+        using value_type = REAL; ///< The type of the matrix elements.
+
         /** @brief Default constructor. Initializes the matrix with uninitialized data. */
-        Mat4() = default;
+        constexpr Mat4() = default;
 
         /**
-         * @brief Construct a matrix from an initializer list.
+         * @brief Construct a matrix from exactly 16 values, e.g. `Mat4<double> m{1.0, 0.0, ...}`.
+         * 
+         * The number of values is checked at compile time.
          * 
-         * @param values A list of 16 values in row-major order.
-         * @throws FlightPath::Exception if the list size is not 16.
+         * @param values 16 values in row-major order.
          */
-        Mat4(std::initializer_list<REAL> values)
-        { 
-            Ensure(values.size() == elements_, "Error: Length of initializer list does not match matrix dimensions!");
+        template <typename... Values>
+            requires (sizeof...(Values) == 16 && (std::convertible_to<Values, REAL> && ...))
+        constexpr Mat4(const Values... values)
+            : data_{static_cast<REAL>(values)...}
+        {
+        }
 
-            std::copy(values.begin(), values.end(), data_.begin());
-        };
+        /**
+         * @brief Construct a matrix from a braced list, e.g. `Mat4<double>({1.0, 0.0, ...})`.
+         * 
+         * The length of the list is checked at compile time.
+         * 
+         * @param values 16 values in row-major order.
+         */
+        template <size_t N>
+            requires (N == 16)
+        constexpr Mat4(const REAL (&values)[N])
+        {
+            SetMatrix(values);
+        }
+
+        /**
+         * @brief Construct a matrix by evaluating an element-wise expression.
+         * 
+         * @param expr An expression (e.g. `A + B * s`) evaluating to a matrix.
+         */
+        template <Expression E>
+            requires (!std::is_same_v<std::remove_cvref_t<E>, Mat4<REAL>> && std::is_same_v<ExpressionResult<E>, Mat4<REAL>>)
+        constexpr Mat4(const E &expr)
+        {
+            Assign(expr);
+        }
+
+        /**
+         * @brief Assigns the result of an element-wise expression.
+         * 
+         * Each element only depends on the same element of the operands, so the
+         * matrix may safely appear in the expression itself (e.g. `A = A + B`).
+         * 
+         * @param expr An expression evaluating to a matrix.
+         * @return Reference to this matrix.
+         */
+        template <Expression E>
+            requires (!std::is_same_v<std::remove_cvref_t<E>, Mat4<REAL>> && std::is_same_v<ExpressionResult<E>, Mat4<REAL>>)
+        constexpr auto operator = (const E &expr) -> Mat4&
+        {
+            Assign(expr);
+            return *this;
+        }
 
         /** @brief Default destructor. */
-        ~Mat4() = default;
+        constexpr ~Mat4() = default;
 
         /**
-         * @brief Sets the matrix values from an initializer list.
+         * @brief Evaluates an expression element-wise into a new matrix.
          * 
-         * @param values A list of 16 values in row-major order.
+         * @param expr The expression to evaluate.
+         * @return The resulting matrix.
          */
-        auto SetMatrix(std::initializer_list<REAL> values) -> void
+        template <typename E>
+        static constexpr auto inline Evaluate(const E &expr) -> Mat4
         {
-            std::copy(values.begin(), values.end(), data_.begin());
+            Mat4 result;
+            result.Assign(expr);
+            return result;
+        }
+
+        /**
+         * @brief Returns an element by its linear (row-major) index, used when evaluating expressions.
+         * 
+         * @param index Linear index of the element.
+         * @return The value of the element.
+         */
+        constexpr auto inline Eval(const size_t index) const -> REAL { return data_[index]; }
+
+        /**
+         * @brief Sets the matrix values from a braced list, e.g. `SetMatrix({1.0, 0.0, ...})`.
+         * 
+         * The length of the list is checked at compile time.
+         * 
+         * @param values 16 values in row-major order.
+         */
+        template <size_t N>
+            requires (N == 16)
+        constexpr auto SetMatrix(const REAL (&values)[N]) -> void
+        {
+            std::copy(values, values + N, data_.begin());
         }
 
         /**
@@ -58,7 +137,7 @@ namespace FlightPath
          * @param col Index of the column to set (0-based).
          * @param v The 3D vector to assign to the column (last row remains unchanged).
          */
-        auto inline SetColumn(const i32 col, const Vec3<REAL> &v) -> void;
+        constexpr auto inline SetColumn(const i32 col, const Vec3<REAL> &v) -> void;
 
         /**
          * @brief Retrieves a specific column of the matrix as a Vec3.
@@ -66,7 +145,7 @@ namespace FlightPath
          * @param col Index of the column to retrieve (0-based).
          * @return A Vec3 containing the first 3 elements of the specified column.
          */
-        auto inline GetColumn(const i32 col) const -> Vec3<REAL>;
+        constexpr auto inline GetColumn(const i32 col) const -> Vec3<REAL>;
 
         /** 
          * @brief Element access operator (mutable).
@@ -75,7 +154,7 @@ namespace FlightPath
          * @param col Column index (0-based).
          * @return Reference to the element at (row, col).
          */
-        auto inline operator()(size_t row, size_t col) -> REAL& { return data_[row * cols_ + col]; }
+        constexpr auto inline operator()(size_t row, size_t col) -> REAL& { return data_[row * cols_ + col]; }
 
         /** 
          * @brief Element access operator (const).
@@ -84,23 +163,7 @@ namespace FlightPath
          * @param col Column index (0-based).
          * @return Const reference to the element at (row, col).
          */
-        auto inline operator()(size_t row, size_t col) const -> const REAL& { return data_[row * cols_ + col]; }
-
-        /**
-         * @brief Matrix addition.
-         * 
-         * @param other The matrix to add.
-         * @return A new matrix containing the sum.
-         */
-        auto inline operator + (const Mat4<REAL>& other) const -> Mat4<REAL>;
-
-        /**
-         * @brief Matrix subtraction.
-         * 
-         * @param other The matrix to subtract.
-         * @return A new matrix containing the difference.
-         */
-        auto inline operator - (const Mat4<REAL>& other) const -> Mat4<REAL>;
+        constexpr auto inline operator()(size_t row, size_t col) const -> const REAL& { return data_[row * cols_ + col]; }
 
         /**
          * @brief Matrix-matrix multiplication.
@@ -108,16 +171,8 @@ namespace FlightPath
          * @param B The right-hand side matrix.
          * @return A new matrix containing the product.
          */
-        auto inline operator * (const Mat4<REAL>& B) const -> Mat4<REAL>;  
+        constexpr auto inline operator * (const Mat4<REAL>& B) const -> Mat4<REAL>;  
 
-        /**
-         * @brief Matrix-scalar multiplication.
-         * 
-         * @param scalar The scalar value to multiply by.
-         * @return A new matrix with all elements multiplied by scalar.
-         */
-        auto inline operator * (const REAL scalar) const -> Mat4<REAL>;
-        
         /**
          * @brief Prints the matrix to std::cout with a custom label.
          * 
@@ -137,14 +192,14 @@ namespace FlightPath
          * 
          * @return Pointer to the beginning of the data array.
          */
-        auto inline RawPtr() -> REAL* { return data_.data(); }
+        constexpr auto inline RawPtr() -> REAL* { return data_.data(); }
         
         /**
          * @brief Returns a raw pointer to the underlying matrix data (const).
          * 
          * @return Const pointer to the beginning of the data array.
          */
-        auto inline RawPtr() const -> const REAL* { return data_.data(); }
+        constexpr auto inline RawPtr() const -> const REAL* { return data_.data(); }
 
         /**
          * @brief Gets the number of matrix rows.
@@ -164,6 +219,17 @@ namespace FlightPath
          */
         constexpr auto inline elements() const -> size_t { return elements_; }
 
+    private:
+        /// @brief Evaluates all elements of an expression in a single loop.
+        template <typename E>
+        constexpr auto inline Assign(const E &expr) -> void
+        {
+            for (size_t i = 0; i < elements_; ++i)
+            {
+                data_[i] = expr.Eval(i);
+            }
+        }
+
     private:
         std::array<REAL, 16> data_;
         static constexpr size_t rows_ = 4;
@@ -171,92 +237,64 @@ namespace FlightPath
         static constexpr size_t elements_ = 16;
     };
 
+    /// @brief Matrices are the leaves of matrix expressions.
     template <typename REAL>
-    auto inline Mat4<REAL>::operator + (const Mat4<REAL>& other) const -> Mat4<REAL>
-    {
-        Mat4<REAL> C;
-
-        for (size_t row = 0; row < rows_; ++row)
-        {
-            const REAL Ai0 = (*this)(row, 0); const REAL Bi0 = other(row, 0);
-            const REAL Ai1 = (*this)(row, 1); const REAL Bi1 = other(row, 1);
-            const REAL Ai2 = (*this)(row, 2); const REAL Bi2 = other(row, 2);
-            const REAL Ai3 = (*this)(row, 3); const REAL Bi3 = other(row, 3);
-
-            C(row, 0) = Ai0 + Bi0;
-            C(row, 1) = Ai1 + Bi1;
-            C(row, 2) = Ai2 + Bi2;
-            C(row, 3) = Ai3 + Bi3;
-        }
-        
-        return C;
-    }
+    struct ExpressionTraits<Mat4<REAL>> { using result_type = Mat4<REAL>; };
 
     template <typename REAL>
-    auto inline Mat4<REAL>::operator - (const Mat4<REAL>& other) const -> Mat4<REAL>
+    constexpr auto Mat4<REAL>::operator * (const Mat4<REAL>& B) const -> Mat4<REAL>
     {
         Mat4<REAL> C;
 
-        for (size_t row = 0; row < rows_; ++row)
+        if consteval
         {
-            const REAL Ai0 = (*this)(row, 0); const REAL Bi0 = other(row, 0);
-            const REAL Ai1 = (*this)(row, 1); const REAL Bi1 = other(row, 1);
-            const REAL Ai2 = (*this)(row, 2); const REAL Bi2 = other(row, 2);
-            const REAL Ai3 = (*this)(row, 3); const REAL Bi3 = other(row, 3);
-
-            C(row, 0) = Ai0 - Bi0;
-            C(row, 1) = Ai1 - Bi1;
-            C(row, 2) = Ai2 - Bi2;
-            C(row, 3) = Ai3 - Bi3;
+            // constant folding of compile time transforms
+            Kernels::Multiply4x4Scalar(RawPtr(), B.RawPtr(), C.RawPtr());
         }
-        
-        return C;
-    }
-
-    template <typename REAL>
-    auto inline Mat4<REAL>::operator * (const REAL scalar) const -> Mat4<REAL>
-    {
-        Mat4<REAL> C;
-
-        for (size_t i = 0; i < rows_; ++i)
+        else
         {
-            const REAL Ai0 = (*this)(i, 0);
-            const REAL Ai1 = (*this)(i, 1);
-            const REAL Ai2 = (*this)(i, 2);
-            const REAL Ai3 = (*this)(i, 3);
-
-            C(i, 0) = Ai0 * scalar;
-            C(i, 1) = Ai1 * scalar;
-            C(i, 2) = Ai2 * scalar;
-            C(i, 3) = Ai3 * scalar;
+            if constexpr (std::is_same_v<REAL, double> || std::is_same_v<REAL, float>)
+            {
+                // vectorized kernel for the instruction set of the running cpu, resolved once, scalar code stays inlinable
+                if (const Kernels::Kernel4x4<REAL> kernel = Kernels::GetMultiply4x4Kernel<REAL>())
+                {
+                    kernel(RawPtr(), B.RawPtr(), C.RawPtr());
+                }
+                else
+                {
+                    Kernels::Multiply4x4Scalar(RawPtr(), B.RawPtr(), C.RawPtr());
+                }
+            }
+            else
+            {
+                Kernels::Multiply4x4Scalar(RawPtr(), B.RawPtr(), C.RawPtr());
+            }
         }
 
         return C;
     }
 
-    template <typename REAL>
-    auto Mat4<REAL>::operator * (const Mat4<REAL>& B) const -> Mat4<REAL>
+    /**
+     * @brief Matrix-matrix multiplication with an unevaluated operand, e.g. `(A + B) * C`.
+     *
+     * The product needs every element of both operands several times, so expression operands
+     * are evaluated once before the kernel runs.
+     *
+     * @param lhs Left-hand side matrix or expression.
+     * @param rhs Right-hand side matrix or expression.
+     * @return The product.
+     */
+    template <Expression L, Expression R>
+        requires (std::is_same_v<ExpressionResult<L>, Mat4<ExpressionScalar<L>>> && std::is_same_v<ExpressionResult<L>, ExpressionResult<R>>)
+    constexpr auto inline operator * (const L &lhs, const R &rhs) -> ExpressionResult<L>
     {
-        Mat4<REAL> C;
-
-        for (size_t i = 0; i < rows_; ++i)
-        {
-            const REAL Ai0 = (*this)(i, 0);
-            const REAL Ai1 = (*this)(i, 1);
-            const REAL Ai2 = (*this)(i, 2);
-            const REAL Ai3 = (*this)(i, 3);
-
-            C(i, 0) = Ai0 * B(0, 0) + Ai1 * B(1, 0) + Ai2 * B(2, 0) + Ai3 * B(3, 0);
-            C(i, 1) = Ai0 * B(0, 1) + Ai1 * B(1, 1) + Ai2 * B(2, 1) + Ai3 * B(3, 1);
-            C(i, 2) = Ai0 * B(0, 2) + Ai1 * B(1, 2) + Ai2 * B(2, 2) + Ai3 * B(3, 2);
-            C(i, 3) = Ai0 * B(0, 3) + Ai1 * B(1, 3) + Ai2 * B(2, 3) + Ai3 * B(3, 3);
-        }
-
-        return C;
+        const ExpressionResult<L> &A = lhs;
+        const ExpressionResult<R> &B = rhs;
+        return A * B;
     }
 
     template <typename REAL>
-    auto Mat4<REAL>::SetColumn(const i32 col, const Vec3<REAL> &v) -> void
+    constexpr auto Mat4<REAL>::SetColumn(const i32 col, const Vec3<REAL> &v) -> void
     {
         (*this)(0, col) = v.x;
         (*this)(1, col) = v.y;
@@ -264,7 +302,7 @@ namespace FlightPath
     }
 
     template <typename REAL>
-    auto Mat4<REAL>::GetColumn(const i32 col) const -> Vec3<REAL>
+    constexpr auto Mat4<REAL>::GetColumn(const i32 col) const -> Vec3<REAL>
     {
         return Vec3<REAL>{
             .x = (*this)(0, col), 
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <string_view>
+
+/**
+ * @namespace FlightPath::Kernels
+ * @brief Explicitly vectorized 4x4 matrix kernels with runtime instruction set dispatch.
+ *
+ * All kernels operate on 16 contiguous values in row-major order (the layout of Mat4).
+ * The output must not alias one of the inputs.
+ */
+namespace FlightPath::Kernels
+{
+    /**
+     * @brief Instruction set levels for which dedicated kernels are available.
+     */
+    enum class SimdLevel
+    {
+        Scalar, ///< Portable C++ implementation, always available.
+        AVX2,   ///< 256-bit AVX2 with fused multiply-add.
+        AVX512  ///< 512-bit AVX-512F.
+    };
+
+    /**
+     * @brief Queries the CPU (via CPUID) for the best supported instruction set level.
+     * @return The highest SimdLevel supported by the CPU and operating system.
+     */
+    auto DetectSimdLevel() -> SimdLevel;
+
+    /**
+     * @brief Returns the instruction set level used by the dispatched kernels.
+     *
+     * The level is selected once on first use and cached afterwards. It is the detected level
+     * capped at AVX2, because the AVX-512 kernels have a higher latency in chained products.
+     *
+     * @return The active SimdLevel.
+     */
+    auto GetSimdLevel() -> SimdLevel;
+
+    /**
+     * @brief Checks whether kernels of a given level can be executed on this machine.
+     * @param level The level to check.
+     * @return True if the level is supported, false otherwise.
+     */
+    auto IsSupported(const SimdLevel level) -> bool;
+
+    /**
+     * @brief Converts a SimdLevel to a human readable name.
+     * @param level The level to convert.
+     * @return A string view containing the name (e.g. "AVX2").
+     */
+    auto ToString(const SimdLevel level) -> std::string_view;
+
+    /**
+     * @brief Portable 4x4 matrix-matrix multiplication C = A * B.
+     *
+     * @tparam REAL Floating-point type (e.g., float or double)
+     * @param A Left-hand side matrix (16 values, row-major).
+     * @param B Right-hand side matrix (16 values, row-major).
+     * @param C Output matrix (16 values, row-major).
+     */
+    template <typename REAL>
+    constexpr auto inline Multiply4x4Scalar(const REAL *A, const REAL *B, REAL *C) -> void
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            const REAL Ai0 = A[i*4 + 0];
+            const REAL Ai1 = A[i*4 + 1];
+            const REAL Ai2 = A[i*4 + 2];
+            const REAL Ai3 = A[i*4 + 3];
+
+            C[i*4 + 0] = Ai0 * B[0] + Ai1 * B[4] + Ai2 * B[ 8] + Ai3 * B[12];
+            C[i*4 + 1] = Ai0 * B[1] + Ai1 * B[5] + Ai2 * B[ 9] + Ai3 * B[13];
+            C[i*4 + 2] = Ai0 * B[2] + Ai1 * B[6] + Ai2 * B[10] + Ai3 * B[14];
+            C[i*4 + 3] = Ai0 * B[3] + Ai1 * B[7] + Ai2 * B[11] + Ai3 * B[15];
+        }
+    }
+
+    /// @brief Signature of a 4x4 matrix-matrix multiplication kernel C = A * B.
+    template <typename REAL>
+    using Kernel4x4 = void (*)(const REAL *A, const REAL *B, REAL *C);
+
+    /**
+     * @brief Returns the vectorized kernel for the active SimdLevel.
+     *
+     * Resolved once on first use. Mainly intended for GetMultiply4x4Kernel, which caches the result.
+     *
+     * @tparam REAL float or double
+     * @return The kernel, or nullptr if the level is Scalar (callers inline Multiply4x4Scalar instead).
+     */
+    template <typename REAL>
+    auto SelectMultiply4x4Kernel() -> Kernel4x4<REAL>;
+
+    template <> auto SelectMultiply4x4Kernel<double>() -> Kernel4x4<double>;
+    template <> auto SelectMultiply4x4Kernel<float>()  -> Kernel4x4<float>;
+
+    /**
+     * @brief Returns the dispatched kernel without a call into the library after the first use.
+     *
+     * Lets Mat4::operator* call the vectorized kernel directly and keep the scalar path inlinable.
+     *
+     * @tparam REAL float or double
+     * @return The kernel, or nullptr if Multiply4x4Scalar should be used.
+     */
+    template <typename REAL>
+    auto inline GetMultiply4x4Kernel() -> Kernel4x4<REAL>
+    {
+        static const Kernel4x4<REAL> kernel = SelectMultiply4x4Kernel<REAL>();
+        return kernel;
+    }
+
+    /**
+     * @brief 4x4 matrix-matrix multiplication C = A * B using the best available kernel.
+     * @param A Left-hand side matrix (16 values, row-major).
+     * @param B Right-hand side matrix (16 values, row-major).
+     * @param C Output matrix (16 values, row-major).
+     */
+    auto Multiply4x4(const double *A, const double *B, double *C) -> void;
+
+    /// @copydoc Multiply4x4(const double*, const double*, double*)
+    auto Multiply4x4(const float *A, const float *B, float *C) -> void;
+
+    /**
+     * @brief 4x4 matrix-matrix multiplication C = A * B using the kernel of a specific level.
+     *
+     * Mainly intended for testing and benchmarking the individual kernels.
+     *
+     * @param A Left-hand side matrix (16 values, row-major).
+     * @param B Right-hand side matrix (16 values, row-major).
+     * @param C Output matrix (16 values, row-major).
+     * @param level The kernel to use.
+     * @throws FlightPath::Exception if the level is not supported on this machine.
+     */
+    auto Multiply4x4(const double *A, const double *B, double *C, const SimdLevel level) -> void;
+
+    /// @copydoc Multiply4x4(const double*, const double*, double*, const SimdLevel)
+    auto Multiply4x4(const float *A, const float *B, float *C, const SimdLevel level) -> void;
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FlightPath
+{
+    /**
+     * @class MemoryAccount
+     * @brief Current and peak number of bytes allocated through the TrackingAllocators bound to it.
+     *
+     * Thread-safe, the counters are relaxed atomics. Containers only allocate when they grow, so
+     * accounting costs nothing in steady state.
+     */
+    class MemoryAccount
+    {
+    public:
+        /// @brief Creates an empty account.
+        MemoryAccount() = default;
+
+        MemoryAccount(const MemoryAccount&) = delete;
+        auto operator=(const MemoryAccount&) -> MemoryAccount& = delete;
+
+        /**
+         * @brief Books an allocation.
+         * @param bytes Size of the allocation.
+         */
+        auto Allocate(const size_t bytes) noexcept -> void;
+
+        /**
+         * @brief Books a deallocation.
+         * @param bytes Size of the allocation.
+         */
+        auto Deallocate(const size_t bytes) noexcept -> void;
+
+        /// @brief Returns the number of currently allocated bytes.
+        auto GetCurrent() const -> size_t { return current_.load(std::memory_order_relaxed); }
+
+        /// @brief Returns the largest number of allocated bytes since creation or the last ResetPeak.
+        auto GetPeak() const -> size_t { return peak_.load(std::memory_order_relaxed); }
+
+        /// @brief Lowers the peak to the current number of allocated bytes (e.g. at the begin of a phase).
+        auto ResetPeak() -> void { peak_.store(GetCurrent(), std::memory_order_relaxed); }
+
+    private:
+        std::atomic<size_t> current_{0}; ///< Currently allocated bytes.
+        std::atomic<size_t> peak_{0};    ///< Peak of current_.
+    };
+
+    /**
+     * @class TrackingAllocator
+     * @brief Standard allocator that books its allocations in a MemoryAccount.
+     *
+     * The account must outlive every container using the allocator. Allocators compare equal if
+     * they book into the same account.
+     *
+     * @tparam T The allocated type.
+     */
+    template <typename T>
+    class TrackingAllocator
+    {
+    public:
+        using value_type = T;
+
+        /**
+         * @brief Creates an allocator booking into an account.
+         * @param account The account.
+         */
+        explicit TrackingAllocator(MemoryAccount &account) noexcept : account_(&account) {}
+
+        /// @brief Rebinds an allocator of another type to the same account.
+        template <typename U>
+        TrackingAllocator(const TrackingAllocator<U> &other) noexcept : account_(other.GetAccount()) {}
+
+        /// @brief Allocates memory for n objects.
+        auto allocate(const size_t n) -> T*
+        {
+            T *pointer = std::allocator<T>().allocate(n);
+            account_->Allocate(n * sizeof(T));
+            return pointer;
+        }
+
+        /// @brief Frees memory of n objects.
+        auto deallocate(T *pointer, const size_t n) noexcept -> void
+        {
+            account_->Deallocate(n * sizeof(T));
+            std::allocator<T>().deallocate(pointer, n);
+        }
+
+        /// @brief Returns the account allocations are booked into.
+        auto GetAccount() const -> MemoryAccount* { return account_; }
+
+        template <typename U>
+        auto operator==(const TrackingAllocator<U> &other) const -> bool { return account_ == other.GetAccount(); }
+
+    private:
+        MemoryAccount *account_; ///< The account, never nullptr.
+    };
+
+    /// @brief A vector booking its memory in a MemoryAccount.
+    template <typename T>
+    using TrackedVector = std::vector<T, TrackingAllocator<T>>;
+
+    /**
+     * @brief Returns the account of transient buffers (e.g. KML output buffers and simplification windows).
+     * @return The process-wide account.
+     */
+    auto GetTransientMemory() -> MemoryAccount&;
+
+    /**
+     * @struct ResidentMemory
+     * @brief Resident set size of the process.
+     */
+    struct ResidentMemory
+    {
+        size_t current = 0; ///< Current resident set size in bytes, 0 if unknown.
+        size_t peak    = 0; ///< Peak resident set size in bytes since the start or the last ResetPeakResidentMemory, 0 if unknown.
+    };
+
+    /**
+     * @brief Samples the resident set size of the process.
+     *
+     * Reads VmRSS and VmHWM from /proc/self/status on Linux, other Unix platforms only provide the
+     * peak (getrusage). Returns zeros elsewhere.
+     *
+     * @return The current and peak resident set size.
+     */
+    auto GetResidentMemory() -> ResidentMemory;
+
+    /**
+     * @brief Resets the peak resident set size to the current one (Linux only, /proc/self/clear_refs).
+     * @return False if the platform can not reset it, the peak is the one of the process then.
+     */
+    auto ResetPeakResidentMemory() -> bool;
+
+    /**
+     * @struct MemoryPhase
+     * @brief Memory footprint of a named phase of a run.
+     */
+    struct MemoryPhase
+    {
+        std::string name;                ///< Name of the phase (e.g. "integrate").
+        size_t      samples         = 0; ///< Number of flight data samples processed in the phase.
+        size_t      input_bytes     = 0; ///< Peak allocation of the input entries.
+        size_t      output_bytes    = 0; ///< Peak allocation of the reconstructed entries.
+        size_t      transient_bytes = 0; ///< Peak allocation of transient buffers.
+        size_t      resident_peak   = 0; ///< Peak resident set size of the process in bytes, 0 if unknown.
+        bool        resident_reset  = false; ///< True if resident_peak is the peak of the phase, otherwise the one of the process.
+
+        /// @brief Returns the tracked bytes (input, output and transient) per sample, 0 if there are no samples.
+        auto GetBytesPerSample() const -> double;
+    };
+}
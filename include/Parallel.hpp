@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace FlightPath
+{
+    /**
+     * @brief Calls function(i) for every i in [0, count) on all hardware threads.
+     *
+     * Worker w processes the indices w, w + workers, w + 2*workers, ..., the calling thread
+     * is worker 0. Returns after all calls are done. The first exception thrown by a worker
+     * is rethrown.
+     *
+     * @param count    Number of indices.
+     * @param function Callable taking a size_t index, must be safe to call concurrently.
+     */
+    template <typename Function>
+    auto inline ParallelFor(const size_t count, Function &&function) -> void
+    {
+        const size_t worker_count = std::max<size_t>(1, std::min<size_t>(count, std::thread::hardware_concurrency()));
+
+        std::vector<std::future<void>> workers;
+        for (size_t w = 1; w < worker_count; ++w)
+        {
+            workers.push_back(std::async(std::launch::async, [&function, count, worker_count, w]
+            {
+                for (size_t i = w; i < count; i += worker_count) function(i);
+            }));
+        }
+
+        for (size_t i = 0; i < count; i += worker_count) function(i);
+        for (auto &worker : workers) worker.get();
+    }
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace FlightPath
+{
+    /**
+     * @brief Hardware events counted by PerfCounters.
+     */
+    enum class PerfEvent
+    {
+        Cycles,         ///< CPU cycles.
+        Instructions,   ///< Retired instructions.
+        L1DMisses,      ///< Level 1 data cache read misses.
+        LLCMisses,      ///< Last level cache misses.
+        BranchMisses,   ///< Mispredicted branches.
+    };
+
+    /// @brief Number of PerfEvent values.
+    inline constexpr size_t PerfEventCount = 5;
+
+    /**
+     * @brief Returns the name of an event (e.g. "cycles").
+     * @param event The event.
+     * @return The name.
+     */
+    auto GetName(const PerfEvent event) -> std::string_view;
+
+    /**
+     * @struct PerfSample
+     * @brief Event counts of one measured interval.
+     *
+     * Counts are scaled up if the kernel had to multiplex the counters. Events the machine does not
+     * count (or not at all, see PerfCounters::IsAvailable) have no value.
+     */
+    struct PerfSample
+    {
+        std::array<uint64_t, PerfEventCount> counts{}; ///< Count of every event, valid if the event is valid.
+        std::array<bool,     PerfEventCount> valid{};  ///< True if the event was counted.
+
+        /**
+         * @brief Returns the count of an event.
+         * @param event The event.
+         * @return The count, empty if the event was not counted.
+         */
+        auto Get(const PerfEvent event) const -> std::optional<uint64_t>;
+
+        /// @brief Returns the retired instructions per cycle, empty unless both were counted.
+        auto GetIPC() const -> std::optional<double>;
+
+        /**
+         * @brief Returns the count of an event per processed item (e.g. per flight data sample).
+         * @param event The event.
+         * @param items The number of items.
+         * @return The count divided by items, empty if the event was not counted or there are no items.
+         */
+        auto GetPer(const PerfEvent event, const size_t items) const -> std::optional<double>;
+    };
+
+    /**
+     * @struct PerfPhase
+     * @brief Event counts of a named phase of a run.
+     */
+    struct PerfPhase
+    {
+        std::string name;    ///< Name of the phase (e.g. "integrate").
+        size_t      samples; ///< Number of flight data samples processed in the phase.
+        PerfSample  sample;  ///< The event counts.
+    };
+
+    /**
+     * @class PerfCounters
+     * @brief Counts hardware events of the calling thread with Linux perf_event_open.
+     *
+     * Threads started by the calling thread after construction (e.g. the workers of ParallelFor)
+     * are counted as well, threads that already run when the counters are opened are not.
+     *
+     * Every event is opened on its own (user space only), so a machine lacking e.g. an LLC event
+     * still counts the others. If no event can be opened (other platforms, virtual machines
+     * without a PMU, kernel.perf_event_paranoid > 2) the counters are unavailable and Stop returns
+     * an empty sample, everything else keeps working.
+     */
+    class PerfCounters
+    {
+    public:
+        /// @brief Opens the counters for the calling thread and the threads it starts later, disabled until Start.
+        PerfCounters();
+
+        /// @brief Closes the counters.
+        ~PerfCounters();
+
+        PerfCounters(const PerfCounters&) = delete;
+        auto operator=(const PerfCounters&) -> PerfCounters& = delete;
+
+        /// @brief Returns true if at least one event can be counted.
+        auto IsAvailable() const -> bool;
+
+        /// @brief Returns why no event can be counted, empty if IsAvailable.
+        auto GetError() const -> const std::string& { return error_; }
+
+        /// @brief Starts all counters, the counts of earlier intervals are subtracted by Stop.
+        auto Start() -> void;
+
+        /**
+         * @brief Stops all counters.
+         * @return The counts since Start.
+         */
+        auto Stop() -> PerfSample;
+
+    private:
+        std::array<int, PerfEventCount> files_; ///< File descriptor per event, -1 if it could not be opened.
+        std::string error_;                     ///< Reason of the last failed open.
+
+        /// @brief Value, time enabled and time running of every event at Start.
+        std::array<std::array<uint64_t, 3>, PerfEventCount> start_{};
+    };
+}
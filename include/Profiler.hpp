@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#ifndef FLIGHTPATH_PROFILING
+    /// @brief 1 if the phases of Application are timed, set by the CMake option ENABLE_PROFILING.
+    #define FLIGHTPATH_PROFILING 0
+#endif
+
+/**
+ * @namespace FlightPath::Profiler
+ * @brief Scoped timers that nest into a tree of phases (e.g. reconstruct > integrate).
+ *
+ * Every ScopedTimer adds its wall time (monotonic clock) to the phase of its name below the
+ * phase of the enclosing timer. A phase keeps count, total, minimum, maximum and a logarithmic
+ * histogram of its durations for percentiles, so its memory does not grow with the number of calls.
+ *
+ * The program times its phases with Scope, which is a ScopedTimer if profiling is compiled in
+ * (ENABLE_PROFILING) and an empty type otherwise. Timers are meant for a single thread (e.g. the
+ * thread of Application::Run).
+ *
+ * Usage:
+ * @code
+ * {
+ *     Profiler::Scope scope("integrate");
+ *     ...
+ * }
+ * Profiler::WriteSummary(std::cout);
+ * @endcode
+ */
+namespace FlightPath::Profiler
+{
+    /// @brief True if the phases of the program are timed.
+    inline constexpr bool Enabled = FLIGHTPATH_PROFILING != 0;
+
+    /// @brief Number of histogram buckets, 4 per power of two of nanoseconds up to 2^64 ns.
+    inline constexpr size_t BucketCount = 252;
+
+    /**
+     * @struct Phase
+     * @brief Statistics of one phase and its nested phases.
+     */
+    struct Phase
+    {
+        std::string name;                           ///< Name given to the timers.
+        Phase      *parent = nullptr;               ///< Enclosing phase, nullptr for the root.
+        std::vector<std::unique_ptr<Phase>> children{}; ///< Nested phases in order of their first call.
+
+        uint64_t count    = 0;                      ///< Number of calls.
+        uint64_t total_ns = 0;                      ///< Sum of all durations.
+        uint64_t min_ns   = UINT64_MAX;             ///< Shortest duration.
+        uint64_t max_ns   = 0;                      ///< Longest duration.
+        std::array<uint64_t, BucketCount> histogram{}; ///< Number of durations per bucket (see GetBucket).
+
+        /**
+         * @brief Adds the duration of one call.
+         * @param duration_ns The duration in ns.
+         */
+        auto Add(const uint64_t duration_ns) -> void;
+
+        /**
+         * @brief Returns a percentile of the durations, estimated from the histogram.
+         * @param percentile The percentile in [0, 100].
+         * @return The duration in ns (within [min_ns, max_ns], 0 if there are no calls).
+         */
+        auto GetPercentile(const double percentile) const -> uint64_t;
+
+        /// @brief Returns the total minus the totals of the nested phases.
+        auto GetSelfTime() const -> uint64_t;
+    };
+
+    /**
+     * @brief Returns the histogram bucket of a duration.
+     * @param duration_ns The duration in ns.
+     * @return The bucket, buckets are about 19 % wide (exact below 4 ns).
+     */
+    auto GetBucket(const uint64_t duration_ns) -> size_t;
+
+    /// @brief Returns the root of the phase tree, its children are the outermost phases.
+    auto GetRoot() -> const Phase&;
+
+    /// @brief Removes all phases, must not be called while a timer is alive.
+    auto Reset() -> void;
+
+    /**
+     * @brief Writes the phase tree as an indented table (count, total, self, mean and percentiles).
+     * @param output Stream to write to.
+     */
+    auto WriteSummary(std::ostream &output) -> void;
+
+    /**
+     * @brief Writes the phase tree as JSON.
+     *
+     * Every phase is an object with name, count, total_ns, self_ns, min_ns, max_ns, mean_ns,
+     * p50_ns, p90_ns, p99_ns and children.
+     *
+     * @param path Path of the report, replaced if it exists.
+     * @throws FlightPath::Exception if the file can not be written.
+     */
+    auto WriteJSON(const std::string &path) -> void;
+
+    /**
+     * @class ScopedTimer
+     * @brief Times the scope it lives in as the phase of its name.
+     */
+    class ScopedTimer
+    {
+    public:
+        /**
+         * @brief Enters the phase and starts the clock.
+         * @param name The name of the phase (unique among the phases of the enclosing timer).
+         */
+        explicit ScopedTimer(const std::string_view name);
+
+        /// @brief Adds the elapsed time to the phase and leaves it.
+        ~ScopedTimer();
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        auto operator=(const ScopedTimer&) -> ScopedTimer& = delete;
+
+    private:
+        Phase *phase_;                                ///< The timed phase.
+        std::chrono::steady_clock::time_point start_; ///< Start of the scope.
+    };
+
+    /// @brief Stands in for ScopedTimer if profiling is not compiled in, optimized away completely.
+    struct NullTimer
+    {
+        explicit constexpr NullTimer(const std::string_view) {}
+    };
+
+    /// @brief The timer used by the program, a ScopedTimer only if Enabled.
+    using Scope = std::conditional_t<Enabled, ScopedTimer, NullTimer>;
+}
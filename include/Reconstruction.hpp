@@ -0,0 +1,193 @@
+#pragma once
+
+#include <span>
+
+#include "Attitude.hpp"
+#include "Generator.hpp"
+#include "Position.hpp"
+#include "Recorder.hpp"
+#include "ReferenceFrame.hpp"
+#include "Types.hpp"
+#include "Vec3.hpp"
+
+namespace FlightPath
+{
+    /**
+     * @struct InitialState
+     * @brief State of the aircraft at the first sample of a reconstruction.
+     */
+    struct InitialState
+    {
+        Position     position; ///< Geodetic position.
+        Attitude     attitude; ///< Orientation in radians.
+        Vec3<double> velocity; ///< Body-fixed velocity in m/s.
+    };
+
+    /**
+     * @brief Takes the initial state from a logged sample (e.g. the first entry of a flight).
+     * @param entry The sample.
+     * @return Its position, attitude and body-fixed velocity.
+     */
+    auto GetInitialState(const Entry &entry) -> InitialState;
+
+    /**
+     * @struct Pose
+     * @brief Reconstructed state of the aircraft at one sample.
+     */
+    struct Pose
+    {
+        double       time;     ///< Time of the sample in s.
+        Position     position; ///< Geodetic position.
+        Attitude     attitude; ///< Orientation in radians.
+        Vec3<double> velocity; ///< Body-fixed velocity in m/s.
+    };
+
+    /**
+     * @struct ImuColumns
+     * @brief Time and body-fixed IMU measurements as separate columns (e.g. from Columnar::Reader::GetColumn).
+     *
+     * All columns must have the same length.
+     */
+    struct ImuColumns
+    {
+        std::span<const double> time;    ///< Time in s, ascending.
+        std::span<const double> a_x;     ///< Linear acceleration in m/s2.
+        std::span<const double> a_y;     ///< Linear acceleration in m/s2.
+        std::span<const double> a_z;     ///< Linear acceleration in m/s2.
+        std::span<const double> omega_x; ///< Angular velocity in rad/s.
+        std::span<const double> omega_y; ///< Angular velocity in rad/s.
+        std::span<const double> omega_z; ///< Angular velocity in rad/s.
+    };
+
+    /**
+     * @class Reconstructor
+     * @brief Dead reckoning of the flight path from body-fixed accelerations and angular velocities.
+     *
+     * Holds the reference frame and the body-fixed velocity and advances them one sample at a time.
+     * Does no I/O and no logging and never allocates, so it can be embedded in other pipelines.
+     *
+     * Usage:
+     * @code
+     * Reconstructor reconstructor(GetInitialState(data[0]));
+     * for (size_t i = 0; i + 1 < data.size(); ++i)
+     * {
+     *     reconstructor.Step(acceleration(i), angular_velocity(i), data[i+1].time - data[i].time);
+     *     use(reconstructor.GetPosition(), reconstructor.GetAttitude());
+     * }
+     * @endcode
+     */
+    class Reconstructor
+    {
+    public:
+        /// @brief Creates a reconstructor at the default ReferenceFrame with zero velocity, call Reset before stepping.
+        Reconstructor() = default;
+
+        /**
+         * @brief Creates a reconstructor at an initial state.
+         * @param state The state at the first sample.
+         */
+        explicit Reconstructor(const InitialState &state);
+
+        /**
+         * @brief Restarts at an initial state.
+         * @param state The state at the first sample.
+         */
+        auto Reset(const InitialState &state) -> void;
+
+        /**
+         * @brief Integrates the velocity and the transform over one time step, without correcting the transform.
+         * @param acceleration     Body-fixed linear acceleration at the begin of the step in m/s2.
+         * @param angular_velocity Body-fixed angular velocity at the begin of the step in rad/s.
+         * @param dt               Length of the step in s.
+         */
+        auto Integrate(const Vec3<double> &acceleration, const Vec3<double> &angular_velocity, const double dt) -> void;
+
+        /**
+         * @brief Corrects the transform after Integrate (see ReferenceFrame::Orthonormalize).
+         * @return The number of iterations used.
+         */
+        auto Orthonormalize() -> i32 { return frame_.Orthonormalize(); }
+
+        /**
+         * @brief Advances by one time step, Integrate followed by Orthonormalize.
+         * @param acceleration     Body-fixed linear acceleration at the begin of the step in m/s2.
+         * @param angular_velocity Body-fixed angular velocity at the begin of the step in rad/s.
+         * @param dt               Length of the step in s.
+         * @return The number of Orthonormalize iterations used.
+         */
+        auto Step(const Vec3<double> &acceleration, const Vec3<double> &angular_velocity, const double dt) -> i32
+        {
+            Integrate(acceleration, angular_velocity, dt);
+            return Orthonormalize();
+        }
+
+        /// @brief Returns the current geodetic position.
+        auto GetPosition() const -> Position { return frame_.GetPosition(); }
+
+        /// @brief Returns the current orientation.
+        auto GetAttitude() const -> Attitude { return frame_.GetAttitude(); }
+
+        /// @brief Returns the current body-fixed velocity.
+        auto GetVelocity() const -> const Vec3<double>& { return velocity_; }
+
+        /// @brief Returns the reference frame (e.g. for its orthogonality error).
+        auto GetFrame() const -> const ReferenceFrame& { return frame_; }
+
+    private:
+        ReferenceFrame frame_;            ///< Position and orientation.
+        Vec3<double>   velocity_{0,0,0};  ///< Body-fixed velocity.
+    };
+
+    /**
+     * @brief Reconstructs the poses of a flight held in memory.
+     *
+     * output[0] is the initial state at input[0].time, output[i] the state after integrating the
+     * samples 0 to i-1. The input is read in place, nothing is copied, logged or allocated.
+     *
+     * @param input  The logged samples, only time, acceleration and angular velocity are used.
+     * @param state  The state at the first sample (e.g. GetInitialState(input[0])).
+     * @param output Receives one pose per input sample.
+     * @throws FlightPath::Exception if input is empty or output has a different size.
+     */
+    auto Reconstruct(const std::span<const Entry> input, const InitialState &state, const std::span<Pose> output) -> void;
+
+    /**
+     * @brief Reconstructs the poses of a flight held in memory as columns (see the overload for entries).
+     * @param input  The time and IMU columns.
+     * @param state  The state at the first sample.
+     * @param output Receives one pose per sample.
+     * @throws FlightPath::Exception if input is empty, its columns differ in length or output has a different size.
+     */
+    auto Reconstruct(const ImuColumns &input, const InitialState &state, const std::span<Pose> output) -> void;
+
+    /**
+     * @brief Reconstructs the poses of a flight lazily, one pose per consumed element.
+     *
+     * Yields the same poses as Reconstruct, but a pose is only computed when the consumer asks for
+     * it and nothing is buffered, so stopping early (e.g. std::views::take_while on a divergence
+     * threshold) skips the rest of the flight. The input must outlive the generator.
+     *
+     * Usage:
+     * @code
+     * for (const Pose &pose : GeneratePoses(data, GetInitialState(data[0]))
+     *                       | std::views::take_while([](const Pose &pose) { return pose.time < 60.0; }))
+     * {
+     *     ...
+     * }
+     * @endcode
+     *
+     * @param input The logged samples, only time, acceleration and angular velocity are used.
+     * @param state The state at the first sample.
+     * @return The poses, starting with the initial state at input[0].time. Empty if input is empty.
+     */
+    auto GeneratePoses(const std::span<const Entry> input, const InitialState state) -> Generator<Pose>;
+
+    /**
+     * @brief Reconstructs the poses of a flight held as columns lazily (see the overload for entries).
+     * @param input The time and IMU columns, must outlive the generator.
+     * @param state The state at the first sample.
+     * @return The poses, starting with the initial state. Empty if the columns are empty.
+     * @throws FlightPath::Exception if the columns differ in length.
+     */
+    auto GeneratePoses(const ImuColumns &input, const InitialState state) -> Generator<Pose>;
+}
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "Memory.hpp"
 #include "ReferenceFrame.hpp"
 
 namespace FlightPath
 {
+    struct LodSettings;
+    class TrajectoryStore;
+
     /// @brief One line (or entry) in a FlightPath Recorder file
     struct Entry
     {
@@ -28,6 +33,9 @@ namespace FlightPath
         double a_z;          ///< linear acceleration               format:  9.5f, unit: m/s2,  type: Body fixed
     };
 
+    /// @brief Entries whose memory is booked in a MemoryAccount.
+    using EntryVector = TrackedVector<Entry>;
+
     /**
      * @class Recorder
      * @brief Handles reading flight data from file, modifying it, and exporting results.
@@ -36,10 +44,10 @@ namespace FlightPath
     {
     public: 
         /// @brief Default constructor
-        Recorder() = default;
+        Recorder();
 
-        /// @brief Default destructor
-        ~Recorder() = default;
+        /// @brief Destructor, closes an attached store
+        ~Recorder();
 
         /**
          * @brief Reads flight data from a specified file.
@@ -51,21 +59,83 @@ namespace FlightPath
          * @brief Returns the input dataset read from the file.
          * @return A const reference to the vector of input entries.
          */
-        auto GetData() const -> const std::vector<Entry>& { return input_data_; }
+        auto GetData() const -> const EntryVector& { return input_data_; }
 
         /**
          * @brief Writes processed flight data based on current position, attitude, and velocity.
          * @param position Current position in geodetic coordinates.
          * @param attitude Current orientation in Euler angles.
          * @param velocity Current velocity vector in m/s.
+         * @return The written entry (e.g. to forward it to a KMLSink).
+         */
+        auto WriteData(const Position &position, const Attitude &attitude, const Vec3<double> &velocity) -> Entry;
+
+        /**
+         * @brief Selects whether written entries are kept in memory (the default).
+         *
+         * Runs that only stream their results (e.g. into a KMLSink) can disable retaining, so the
+         * memory usage does not grow with the length of the flight. Must be set before ReadFile.
+         *
+         * @param retain True to keep the output data, false to discard it after WriteData.
+         * @throws FlightPath::Exception if called after ReadFile.
+         */
+        auto SetRetainOutput(const bool retain) -> void;
+
+        /**
+         * @brief Reserves memory for retained output entries, so WriteData does not allocate.
+         *
+         * Does nothing if retaining is disabled (see SetRetainOutput), WriteData never allocates then.
+         *
+         * @param capacity Number of output entries, usually GetData().size().
          */
-        auto WriteData(const Position &position, const Attitude &attitude, const Vec3<double> &velocity) -> void;
+        auto ReserveOutput(const size_t capacity) -> void;
+
+        /**
+         * @brief Creates a memory-mapped TrajectoryStore that every written entry is appended to.
+         *
+         * The store holds as many entries as the input data, the first output entry is appended
+         * immediately. Other processes can follow the reconstruction via TrajectoryView. Must be
+         * called after ReadFile.
+         *
+         * @param path Path of the store file.
+         * @throws FlightPath::Exception if no data was read or the file can not be created.
+         */
+        auto OpenStore(const std::string &path) -> void;
 
         /**
          * @brief Exports both original and reconstructed data into a KML file for visualization.
-         * @param path Path to the output KML file.
+         * @param path   Path to the output KML file.
+         * @param stride Only every stride-th entry is exported (1 exports the full resolution).
+         * @throws FlightPath::Exception if stride is zero or the file can not be written.
+         */
+        auto DumpKML(const std::string &path, const size_t stride = 100) const -> void;
+
+        /**
+         * @brief Exports both datasets into a KML file, reduced to the points needed for a given accuracy.
+         *
+         * Both tracks are simplified with the Douglas-Peucker algorithm (see SimplifyTrack), so straight
+         * legs use few points while turns keep their shape.
+         *
+         * @param path      Path to the output KML file.
+         * @param tolerance Maximum deviation of the exported from the full track in meters.
+         * @throws FlightPath::Exception if tolerance is negative or the file can not be written.
          */
-        auto DumpKML(const std::string &path) const -> void;
+        auto DumpSimplifiedKML(const std::string &path, const double tolerance) const -> void;
+
+        /**
+         * @brief Exports both datasets as tiled KML with levels of detail (see ExportLodKML).
+         * @param directory Output directory, the root document is `<directory>/doc.kml`.
+         * @param settings  Tile size, levels of detail and start time.
+         * @throws FlightPath::Exception if the settings are invalid or a file can not be written.
+         */
+        auto DumpLodKML(const std::string &directory, const LodSettings &settings) const -> void;
+
+        /**
+         * @brief Exports the reconstructed data at full resolution into a binary columnar file (see Columnar::Write).
+         * @param path Path to the output file.
+         * @throws FlightPath::Exception if the file can not be written.
+         */
+        auto DumpColumnar(const std::string &path) const -> void;
 
         /**
          * @brief Returns the reconstructed (output) flight data after WriteData calls.
@@ -73,14 +143,29 @@ namespace FlightPath
          * This data represents the processed flight path based on input data combined with 
          * successive position, attitude, and velocity updates. It always begins with a copy 
          * of the first input entry (from ReadFile) and grows with each call to WriteData().
+         * Stays empty if retaining is disabled (see SetRetainOutput).
          *
          * @return A const reference to the vector of reconstructed flight entries.
          */
-        auto GetOutputData() const -> const std::vector<Entry>& { return output_data_; }
+        auto GetOutputData() const -> const EntryVector& { return output_data_; }
+
+        /// @brief Returns the account of the input entries (see GetData).
+        auto GetInputMemory() const -> const MemoryAccount& { return input_memory_; }
+
+        /// @brief Returns the account of the reconstructed entries (see GetOutputData).
+        auto GetOutputMemory() const -> const MemoryAccount& { return output_memory_; }
+
+        /// @brief Lowers the peaks of the input and output accounts to their current allocation (e.g. at the begin of a phase).
+        auto ResetMemoryPeaks() -> void { input_memory_.ResetPeak(); output_memory_.ResetPeak(); }
     private:
 
     private:
-        std::vector<Entry>  input_data_; ///< Original input data from file.
-        std::vector<Entry> output_data_; ///< Modified/reconstructed flight data.
+        MemoryAccount  input_memory_;    ///< Allocations of input_data_, declared first as it must outlive it.
+        MemoryAccount output_memory_;    ///< Allocations of output_data_.
+        EntryVector  input_data_{TrackingAllocator<Entry>(input_memory_)};   ///< Original input data from file.
+        EntryVector output_data_{TrackingAllocator<Entry>(output_memory_)};  ///< Modified/reconstructed flight data.
+        size_t output_size_   = 0;       ///< Number of written output entries (retained or not).
+        bool   retain_output_ = true;    ///< Keep written entries in output_data_.
+        std::unique_ptr<TrajectoryStore> store_; ///< Optional store written entries are appended to.
     };
 }
@@ -6,6 +6,7 @@
 #include "Attitude.hpp"
 #include "Mat4.hpp"
 #include "Vec3.hpp"
+#include "Types.hpp"
 #include "Units.hpp"
 
 namespace FlightPath
@@ -128,22 +129,36 @@ namespace FlightPath
          */
         auto Dot(const Mat4<double> &other) -> void;
 
+        /// @brief Maximum number of correction iterations of Orthonormalize.
+        static constexpr i32 MaxOrthonormalizeIterations = 10;
+
         /**
          * @brief Orthonormalizes the rotation part of the transformation matrix to reduce numerical drift.
+         * @return The number of correction iterations needed (0 if the frame was orthogonal already, at most MaxOrthonormalizeIterations).
          */
-        auto Orthonormalize() -> void;
+        auto Orthonormalize() -> i32;
 
         /**
          * @brief Computes the orthogonality error of the frame's rotation matrix.
          * @return A root-mean-square value of the orthogonal error.
          */
-        auto GetOrthogonalError() -> double;
+        auto GetOrthogonalError() const -> double;
         
         /**
          * @brief Computes the error in the lengths of the rotation matrix's axes from unit length.
          * @return A root-mean-square error of axis length deviation.
          */
-        auto GetLengthError() -> double;
+        auto GetLengthError() const -> double;
+
+        /**
+         * @brief Converts a geodetic position to Earth-centered, Earth-fixed (ECEF) coordinates.
+         *
+         * Uses the same spherical Earth model as the reference frame itself.
+         *
+         * @param position The geodetic position (longitude, latitude, altitude).
+         * @return The position in ECEF coordinates in meters.
+         */
+        static auto GetEarthCoordinates(const Position position) -> Vec3<double>;
 
     private:
         /**
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Memory.hpp"
+#include "Recorder.hpp"
+#include "Vec3Array.hpp"
+
+namespace FlightPath
+{
+    /// @brief Default number of points per independently simplified segment of a track.
+    inline constexpr size_t DefaultSimplifySegmentSize = 4096;
+
+    /**
+     * @brief Simplifies a polyline with the Douglas-Peucker algorithm.
+     *
+     * Every removed point is at most tolerance away from the simplified polyline. The track is
+     * split into segments of segment_size points, whose end points are always kept, and the
+     * segments are simplified in parallel. The result does not depend on the number of threads.
+     *
+     * @param points       The points of the polyline in a metric (e.g. ECEF) coordinate system.
+     * @param tolerance    The maximum allowed deviation in the unit of the points (e.g. meters).
+     * @param segment_size Number of points per independently simplified segment.
+     * @return The ascending indices of the kept points, always including the first and last point.
+     * @throws FlightPath::Exception if tolerance is negative or segment_size is smaller than 2.
+     */
+    auto Simplify(const Vec3Array<double> &points, const double tolerance, const size_t segment_size = DefaultSimplifySegmentSize) -> std::vector<size_t>;
+
+    /**
+     * @brief Simplifies the geographic track of recorded entries.
+     *
+     * Positions are converted to Earth-centered, Earth-fixed coordinates first, so the
+     * tolerance is a distance in meters in all three dimensions (including altitude).
+     *
+     * @param entries      The recorded flight data.
+     * @param tolerance    The maximum allowed deviation in meters.
+     * @param segment_size Number of points per independently simplified segment.
+     * @return The ascending indices of the kept entries.
+     * @throws FlightPath::Exception if tolerance is negative or segment_size is smaller than 2.
+     */
+    auto SimplifyTrack(const std::span<const Entry> entries, const double tolerance, const size_t segment_size = DefaultSimplifySegmentSize) -> std::vector<size_t>;
+
+    /**
+     * @class StreamingSimplifier
+     * @brief Incremental polyline simplification with the opening window algorithm.
+     *
+     * Points are pushed one at a time and the simplifier decides whether the previous point is a
+     * vertex of the simplified polyline. Like Simplify, every removed point is at most tolerance
+     * away from the simplified polyline, but only a bounded window of recent points is stored,
+     * so the memory usage does not depend on the length of the track.
+     *
+     * The directions from the anchor that keep every window point within tolerance are tracked
+     * as a cone, which accepts most points with a constant number of operations. The cone is a
+     * conservative approximation, only if it rejects a point are the window points checked one by
+     * one (at most window_size distances), so the result is the same as with checking every time.
+     */
+    class StreamingSimplifier
+    {
+    public:
+        /// @brief Default maximum number of points between two kept vertices.
+        static constexpr size_t DefaultWindowSize = 512;
+
+        /**
+         * @brief Creates a simplifier.
+         * @param tolerance   The maximum allowed deviation in the unit of the points (e.g. meters).
+         * @param window_size The maximum number of points between two kept vertices, bounds memory and the run time of a single point.
+         * @throws FlightPath::Exception if tolerance is negative or window_size is zero.
+         */
+        explicit StreamingSimplifier(const double tolerance, const size_t window_size = DefaultWindowSize);
+
+        /**
+         * @brief Adds the next point of the polyline.
+         *
+         * The first point of a polyline is always a vertex and so is the last one, which the
+         * caller keeps when the polyline ends.
+         *
+         * @param point The next point in a metric (e.g. ECEF) coordinate system.
+         * @return True if the previously pushed point has to be kept as a vertex.
+         */
+        auto Push(const Vec3<double> &point) -> bool;
+
+        /**
+         * @brief Starts a new polyline.
+         */
+        auto Reset() -> void;
+
+    private:
+        /// @brief Restarts the window at the anchor.
+        auto ClearWindow() -> void;
+
+        /// @brief Adds a point to the window and narrows the cone to the directions that keep it within tolerance.
+        auto AddToWindow(const Vec3<double> &point) -> void;
+
+        /// @brief Returns true if the cone guarantees that the segment anchor -> point represents the window.
+        auto IsInCone(const Vec3<double> &point) const -> bool;
+
+        double tolerance_;           ///< Maximum deviation.
+        double tolerance_squared_;   ///< Squared maximum deviation.
+        size_t window_size_;         ///< Maximum number of points in window_.
+        bool   has_anchor_ = false;  ///< True once the first point of the polyline was pushed.
+        Vec3<double> anchor_{0,0,0}; ///< The last kept vertex.
+        Vec3<double> cone_axis_{1,0,0}; ///< Unit direction of the cone of valid segment directions.
+        double cone_angle_ = 0.0;    ///< Half opening angle of the cone in rad, negative if no direction is valid.
+        double window_radius_ = 0.0; ///< Largest distance of a window point to the anchor.
+        TrackedVector<Vec3<double>> window_{TrackingAllocator<Vec3<double>>(GetTransientMemory())}; ///< Points after the anchor, the last one is the previously pushed point.
+    };
+}
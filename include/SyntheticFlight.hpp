@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Position.hpp"
+#include "Units.hpp"
+
+namespace FlightPath
+{
+    /**
+     * @struct FlightSegment
+     * @brief One maneuver of a scripted synthetic flight.
+     */
+    struct FlightSegment
+    {
+        /// @brief Kinds of maneuvers, all flown at constant speed.
+        enum class Maneuver
+        {
+            Cruise, ///< Straight flight, no rotation.
+            Climb,  ///< Pitch up by angle in the first 20 % of the duration, hold, pitch back in the last 20 % (negative angles descend).
+            Turn,   ///< Constant yaw rate until the heading changed by angle (positive turns right).
+        };
+
+        Maneuver maneuver; ///< The kind of maneuver.
+        double   duration; ///< Duration in s.
+        double   angle = 0.0; ///< Pitch angle of a climb or heading change of a turn in rad.
+    };
+
+    /**
+     * @struct SyntheticFlightSettings
+     * @brief Initial state, sample rate and script of a synthetic flight.
+     */
+    struct SyntheticFlightSettings
+    {
+        Position start{.longitude = 15.44_deg, .latitude = 47.0_deg, .altitude = 1000.0_m}; ///< Initial position.
+        double   heading     = 90.0_deg; ///< Initial heading in rad.
+        double   speed       = 120.0;    ///< Constant true airspeed in m/s.
+        double   start_time  = 0.0;      ///< Time of the first sample in s.
+        double   sample_rate = 100.0;    ///< Samples per second.
+
+        /// @brief The maneuvers, repeated until enough samples are generated (a full cycle returns to the initial heading and altitude).
+        std::vector<FlightSegment> script = {
+            {.maneuver = FlightSegment::Maneuver::Cruise, .duration = 60.0},
+            {.maneuver = FlightSegment::Maneuver::Climb,  .duration = 60.0, .angle =   3.0_deg},
+            {.maneuver = FlightSegment::Maneuver::Turn,   .duration = 45.0, .angle =  90.0_deg},
+            {.maneuver = FlightSegment::Maneuver::Cruise, .duration = 30.0},
+            {.maneuver = FlightSegment::Maneuver::Climb,  .duration = 60.0, .angle =  -3.0_deg},
+            {.maneuver = FlightSegment::Maneuver::Turn,   .duration = 45.0, .angle =  90.0_deg},
+            {.maneuver = FlightSegment::Maneuver::Cruise, .duration = 60.0},
+            {.maneuver = FlightSegment::Maneuver::Turn,   .duration = 90.0, .angle = 180.0_deg},
+        };
+    };
+
+    /**
+     * @brief Writes a deterministic synthetic flight log in the Recorder text format.
+     *
+     * The script defines the body rates and the speed of every sample, a small correction of the
+     * rates keeps the attitude on the script along the curved earth. Position, attitude and
+     * velocity are integrated from the accelerations and rates exactly as written to the file
+     * (i.e. rounded to its precision), with the same scheme as Application::Run. Reconstructing
+     * the log therefore reproduces the logged track, independent of its length.
+     *
+     * @param path         Path of the output file.
+     * @param sample_count Number of samples (lines).
+     * @param settings     Initial state, sample rate and script.
+     * @throws FlightPath::Exception if the settings are invalid or the file can not be written.
+     */
+    auto WriteSyntheticFlight(const std::string &path, const size_t sample_count, const SyntheticFlightSettings &settings = {}) -> void;
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Recorder.hpp"
+
+namespace FlightPath
+{
+    /// @brief Default number of samples per block of a TimeIndex.
+    inline constexpr size_t DefaultTimeIndexBlockSize = 64;
+
+    /**
+     * @struct TimeRange
+     * @brief Half-open range [begin, end) of sample indices.
+     */
+    struct TimeRange
+    {
+        size_t begin; ///< First index in the range.
+        size_t end;   ///< One past the last index in the range.
+
+        /// @brief Returns the number of samples in the range.
+        auto size() const -> size_t { return end - begin; }
+
+        /// @brief Returns true if the range holds no samples.
+        auto empty() const -> bool { return begin == end; }
+    };
+
+    /**
+     * @class TimeIndex
+     * @brief Finds samples by time in an ascending time column without scanning it.
+     *
+     * Keeps the time of every block_size-th sample in a skip table. A query searches the skip table
+     * by interpolation, which takes O(log log n) steps for evenly sampled logs. Every other step is a
+     * bisection, so uneven logs still take at most O(log n) steps. A binary search within the block
+     * follows. The samples are not copied, they must outlive the index and must not change.
+     *
+     * Usage:
+     * @code
+     * const TimeIndex index(recorder.GetData());
+     * const TimeRange window = index.FindRange(60.0, 120.0);
+     * const auto samples = std::span(recorder.GetData()).subspan(window.begin, window.size());
+     * @endcode
+     */
+    class TimeIndex
+    {
+    public:
+        /**
+         * @brief Indexes the time of flight data entries.
+         * @param entries    The entries, ascending by time.
+         * @param block_size Number of samples per skip table entry.
+         * @throws FlightPath::Exception if entries is empty, block_size is zero or the times descend.
+         */
+        explicit TimeIndex(const std::span<const Entry> entries, const size_t block_size = DefaultTimeIndexBlockSize);
+
+        /**
+         * @brief Indexes a time column (e.g. from Columnar::Reader::GetColumn or ImuColumns::time).
+         * @param times      The times, ascending.
+         * @param block_size Number of samples per skip table entry.
+         * @throws FlightPath::Exception if times is empty, block_size is zero or the times descend.
+         */
+        explicit TimeIndex(const std::span<const double> times, const size_t block_size = DefaultTimeIndexBlockSize);
+
+        /// @brief Returns the number of indexed samples.
+        auto size() const -> size_t { return size_; }
+
+        /**
+         * @brief Returns the time of a sample.
+         * @param index The index of the sample, less than size().
+         * @return The time in s.
+         */
+        auto GetTime(const size_t index) const -> double;
+
+        /**
+         * @brief Finds the sample at or directly before a time.
+         * @param time The time in s.
+         * @return The index of the last sample with a time not after time, 0 if time precedes all samples.
+         */
+        auto FindIndex(const double time) const -> size_t;
+
+        /**
+         * @brief Finds the first sample at or after a time.
+         * @param time The time in s.
+         * @return The index of the first sample with a time not before time, size() if there is none.
+         */
+        auto LowerBound(const double time) const -> size_t;
+
+        /**
+         * @brief Finds the first sample after a time.
+         * @param time The time in s.
+         * @return The index of the first sample with a time after time, size() if there is none.
+         */
+        auto UpperBound(const double time) const -> size_t;
+
+        /**
+         * @brief Finds the samples within a closed time interval.
+         * @param begin_time Begin of the interval in s.
+         * @param end_time   End of the interval in s (inclusive).
+         * @return The samples with begin_time <= time <= end_time, empty if there are none or end_time < begin_time.
+         */
+        auto FindRange(const double begin_time, const double end_time) const -> TimeRange;
+
+    private:
+        /// @brief Creates the skip table, called by both constructors.
+        auto Build() -> void;
+
+        /**
+         * @brief Returns the first sample with a time not before (or, if inclusive, after) time.
+         * @param time      The time in s.
+         * @param inclusive True to skip samples at time (UpperBound), false to stop at them (LowerBound).
+         */
+        auto Search(const double time, const bool inclusive) const -> size_t;
+
+        const std::byte    *base_;       ///< Address of the time of the first sample.
+        size_t              stride_;     ///< Distance between the times of two samples in bytes.
+        size_t              size_;       ///< Number of samples.
+        size_t              block_size_; ///< Samples per skip table entry.
+        std::vector<double> skip_;       ///< Time of every block_size-th sample.
+    };
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @namespace FlightPath::Trace
+ * @brief Begin/end spans of all threads, exported as Chrome trace-event JSON.
+ *
+ * A Span records its name, thread and begin/end time into a buffer owned by the calling
+ * thread, so recording never takes a lock. Close writes the spans of all threads as
+ * complete events ("ph": "X") that open in Perfetto UI (ui.perfetto.dev) or chrome://tracing,
+ * one track per thread.
+ *
+ * While no session is open a span costs a predictable branch at its begin and end.
+ *
+ * Usage:
+ * @code
+ * Trace::Session session("trace.json");
+ * {
+ *     Trace::Span span("Recorder::ReadFile");
+ *     ...
+ * }
+ * session.Close();
+ * @endcode
+ */
+namespace FlightPath::Trace
+{
+    /**
+     * @brief Starts a trace session.
+     * @param path Path of the JSON file written by Close, replaced if it exists.
+     * @throws FlightPath::Exception if a session is already open.
+     */
+    auto Open(const std::string &path) -> void;
+
+    /**
+     * @brief Ends the session and writes the spans of all threads.
+     *
+     * Must not be called while other threads still record (e.g. join them first). Spans that are
+     * still open are not written. Does nothing if no session is open.
+     *
+     * @throws FlightPath::Exception if the file can not be written.
+     */
+    auto Close() -> void;
+
+    /// @brief Returns true while a session is open.
+    auto IsOpen() -> bool;
+
+    /**
+     * @class Session
+     * @brief Keeps a trace session open for its lifetime, so it also ends if an exception leaves the scope.
+     */
+    class Session
+    {
+    public:
+        /**
+         * @brief Starts a trace session (see Open).
+         * @param path Path of the JSON file written by Close, replaced if it exists.
+         * @throws FlightPath::Exception if a session is already open.
+         */
+        explicit Session(const std::string &path);
+
+        /// @brief Ends the session unless Close was called, errors writing the file are ignored.
+        ~Session();
+
+        /**
+         * @brief Ends the session and writes the spans (see Trace::Close), later calls do nothing.
+         * @throws FlightPath::Exception if the file can not be written.
+         */
+        auto Close() -> void;
+
+        Session(const Session&) = delete;
+        auto operator=(const Session&) -> Session& = delete;
+
+    private:
+        bool open_ = false; ///< True until the session is closed.
+    };
+
+    namespace Detail
+    {
+        /// @brief True while a session is open, the only thing a span checks while tracing is off.
+        inline std::atomic<bool> enabled{false};
+
+        /// @brief Returns the time since the start of the session in ns.
+        auto Now() -> uint64_t;
+
+        /// @brief Appends a span to the buffer of the calling thread.
+        auto Record(const char *name, const uint64_t begin_ns, const uint64_t end_ns) -> void;
+    }
+
+    /**
+     * @class Span
+     * @brief Records the scope it lives in as a span of the calling thread.
+     */
+    class Span
+    {
+    public:
+        /**
+         * @brief Begins the span if a session is open.
+         * @param name The name of the span, must outlive the session (e.g. a string literal).
+         */
+        explicit Span(const char *name)
+        {
+            // acquire pairs with Open, so the start time of the session is visible to Now
+            if (Detail::enabled.load(std::memory_order_acquire)) [[unlikely]]
+            {
+                name_  = name;
+                begin_ = Detail::Now();
+            }
+        }
+
+        /// @brief Ends the span unless End was called.
+        ~Span()
+        {
+            End();
+        }
+
+        /// @brief Ends the span before the end of its scope, later calls do nothing.
+        auto End() -> void
+        {
+            if (name_ != nullptr) [[unlikely]]
+            {
+                Detail::Record(name_, begin_, Detail::Now());
+                name_ = nullptr;
+            }
+        }
+
+        Span(const Span&) = delete;
+        auto operator=(const Span&) -> Span& = delete;
+
+    private:
+        const char *name_  = nullptr; ///< Name of the span, nullptr if no session was open at its begin.
+        uint64_t    begin_ = 0;       ///< Begin in ns since the start of the session.
+    };
+}
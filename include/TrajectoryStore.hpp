@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Columnar.hpp"
+#include "MappedFile.hpp"
+#include "Recorder.hpp"
+
+namespace FlightPath
+{
+    /**
+     * @class TrajectoryStore
+     * @brief Persistent, memory-mapped columnar file that Recorder output is appended to.
+     *
+     * The file uses the Columnar layout with a fixed capacity. Append writes the values of an
+     * entry into the shared mapping and then publishes the new Header::row_count with release
+     * semantics, so readers in other processes (see TrajectoryView) that load the count with
+     * acquire semantics always see complete rows, without locks or copies.
+     *
+     * There must be only one writer per file. Values are stored in native byte order, which the
+     * Columnar format requires to be little-endian.
+     */
+    class TrajectoryStore
+    {
+    public:
+        /**
+         * @brief Creates (or replaces) a store file.
+         * @param path     Path of the file.
+         * @param capacity Maximum number of entries.
+         * @throws FlightPath::Exception if the file can not be created or the host is big-endian.
+         */
+        TrajectoryStore(const std::string &path, const uint64_t capacity);
+
+        /// @brief Default destructor, the file stays valid with all published entries.
+        ~TrajectoryStore() = default;
+
+        /**
+         * @brief Appends an entry and publishes it to readers.
+         * @param entry The entry to append.
+         * @throws FlightPath::Exception if the store is full.
+         */
+        auto Append(const Entry &entry) -> void;
+
+        /// @brief Returns the number of appended entries.
+        auto GetSize() const -> uint64_t { return size_; }
+
+        /// @brief Returns the maximum number of entries.
+        auto GetCapacity() const -> uint64_t { return capacity_; }
+
+        /**
+         * @brief Writes the mapping back to disk (e.g. before a controlled shutdown of the machine).
+         * @throws FlightPath::Exception if the file can not be written.
+         */
+        auto Sync() const -> void { file_.Sync(); }
+
+    private:
+        MappedFile file_;                    ///< The read-write mapping.
+        uint64_t   size_     = 0;            ///< Number of appended entries.
+        uint64_t   capacity_ = 0;            ///< Maximum number of entries.
+        std::array<double*, 16> columns_{};  ///< Column blocks in the order of Columnar::GetEntryFields().
+    };
+
+    /**
+     * @class TrajectoryView
+     * @brief Read-only, zero-copy access to a TrajectoryStore file, also while it is written.
+     */
+    class TrajectoryView
+    {
+    public:
+        /**
+         * @brief Maps a store (or any columnar) file read-only.
+         * @param path Path of the file.
+         * @throws FlightPath::Exception if the file can not be mapped or is invalid.
+         */
+        explicit TrajectoryView(const std::string &path);
+
+        /// @brief Default destructor.
+        ~TrajectoryView() = default;
+
+        /**
+         * @brief Returns the number of published entries (acquire), all of them are completely written.
+         * @return The current row count.
+         */
+        auto GetSize() const -> uint64_t;
+
+        /// @brief Returns the maximum number of entries.
+        auto GetCapacity() const -> uint64_t { return GetHeader().capacity; }
+
+        /**
+         * @brief Returns the published rows of a column, pointing directly into the mapping.
+         * @param name The column name (e.g. "altitude").
+         * @return The values of the column, a snapshot of GetSize() rows.
+         * @throws FlightPath::Exception if there is no column of that name.
+         */
+        auto GetColumn(const std::string_view name) const -> std::span<const double>;
+
+        /**
+         * @brief Assembles one published entry.
+         * @param index Index of the entry.
+         * @return The entry.
+         * @throws FlightPath::Exception if index is not published yet.
+         */
+        auto GetEntry(const uint64_t index) const -> Entry;
+
+    private:
+        auto GetHeader() const -> const Columnar::Header& { return *reinterpret_cast<const Columnar::Header*>(file_.GetData().data()); }
+
+    private:
+        MappedFile file_; ///< The read-only mapping.
+        std::array<const double*, 16> columns_{}; ///< Column blocks in the order of Columnar::GetEntryFields().
+    };
+}
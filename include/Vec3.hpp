@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <type_traits>
 
 namespace FlightPath
 {
@@ -8,11 +9,17 @@ namespace FlightPath
      * @struct Vec3
      * @brief A lightweight 3D vector struct for basic vector operations.
      *
+     * Unlike Mat4, arithmetic is evaluated eagerly: a vector fits into registers, so the compiler
+     * removes the temporaries of a chain like `a + b * s` anyway, and the results keep the full
+     * Vec3 interface (e.g. `(a - b).Length()`, `auto c = a + b` or `Vec3<double>{a + b}`).
+     *
      * @tparam REAL The real type (i.e. float or double) used for storage and operations.
      */
     template <typename REAL>
     struct Vec3
     {
+        using value_type = REAL; ///< The type of the components.
+
         REAL x; ///< The x-component of the vector.
         REAL y; ///< The y-component of the vector.
         REAL z; ///< The z-component of the vector.
@@ -22,35 +29,35 @@ namespace FlightPath
          * @param other The vector to add.
          * @return The resulting vector after addition.
          */
-        auto inline operator + (const Vec3 &other) const -> Vec3;
+        constexpr auto inline operator + (const Vec3 &other) const -> Vec3;
 
         /**
          * @brief Subtracts another vector from this vector component-wise.
          * @param other The vector to subtract.
          * @return The resulting vector after subtraction.
          */
-        auto inline operator - (const Vec3 &other) const -> Vec3;
+        constexpr auto inline operator - (const Vec3 &other) const -> Vec3;
 
         /**
          * @brief Multiplies this vector by a scalar.
          * @param scalar The scalar value to multiply by.
          * @return The resulting scaled vector.
          */
-        auto inline operator * (const REAL scalar) const -> Vec3;
+        constexpr auto inline operator * (const REAL scalar) const -> Vec3;
 
         /**
          * @brief Computes the dot product of this vector and another.
          * @param other The other vector.
          * @return The dot product (a scalar).
          */
-        auto inline Dot(const Vec3 &other) const -> REAL;
+        constexpr auto inline Dot(const Vec3 &other) const -> REAL;
 
         /**
          * @brief Computes the cross product of this vector and another.
          * @param other The other vector.
          * @return The resulting vector perpendicular to both.
          */
-        auto inline Cross(const Vec3 &other) const -> Vec3;
+        constexpr auto inline Cross(const Vec3 &other) const -> Vec3;
 
         /**
          * @brief Computes the Euclidean length (magnitude) of the vector.
@@ -62,7 +69,7 @@ namespace FlightPath
          * @brief Computes the squared length of the vector.
          * @return The squared length (avoids square root for performance).
          */
-        auto inline LengthSquared() const -> REAL;
+        constexpr auto inline LengthSquared() const -> REAL;
 
         /**
          * @brief Normalizes the vector in-place to unit length.
@@ -77,7 +84,7 @@ namespace FlightPath
     };
 
     template <typename REAL>
-    auto inline Vec3<REAL>::operator + (const Vec3 &other) const -> Vec3<REAL>
+    constexpr auto inline Vec3<REAL>::operator + (const Vec3<REAL> &other) const -> Vec3<REAL>
     {
         return Vec3<REAL>{
             .x = (this->x + other.x),
@@ -87,7 +94,7 @@ namespace FlightPath
     }
 
     template <typename REAL>
-    auto inline Vec3<REAL>::operator - (const Vec3<REAL> &other) const -> Vec3<REAL>
+    constexpr auto inline Vec3<REAL>::operator - (const Vec3<REAL> &other) const -> Vec3<REAL>
     {
         return Vec3<REAL>{
             .x = (this->x - other.x),
@@ -97,7 +104,7 @@ namespace FlightPath
     }
 
     template <typename REAL>
-    auto inline Vec3<REAL>::operator * (const REAL scalar) const -> Vec3<REAL>
+    constexpr auto inline Vec3<REAL>::operator * (const REAL scalar) const -> Vec3<REAL>
     {
         return Vec3<REAL>{
             .x = (this->x * scalar),
@@ -107,13 +114,13 @@ namespace FlightPath
     }
 
     template <typename REAL>
-    auto inline operator * (const REAL scalar, const Vec3<REAL>& v) -> Vec3<REAL>
+    constexpr auto inline operator * (const std::type_identity_t<REAL> scalar, const Vec3<REAL>& v) -> Vec3<REAL>
     {
         return v * scalar;
     }
 
     template <typename REAL>
-    auto inline Vec3<REAL>::Dot(const Vec3<REAL> &other) const -> REAL
+    constexpr auto inline Vec3<REAL>::Dot(const Vec3<REAL> &other) const -> REAL
     {
         const auto a1 = this->x; const auto b1 = other.x;
         const auto a2 = this->y; const auto b2 = other.y;
@@ -123,7 +130,7 @@ namespace FlightPath
     }
 
     template <typename REAL>
-    auto inline Vec3<REAL>::Cross(const Vec3<REAL> &other) const -> Vec3<REAL>
+    constexpr auto inline Vec3<REAL>::Cross(const Vec3<REAL> &other) const -> Vec3<REAL>
     {
         const auto a1 = this->x; const auto b1 = other.x;
         const auto a2 = this->y; const auto b2 = other.y;
@@ -143,7 +150,7 @@ namespace FlightPath
     }
 
     template <typename REAL>
-    auto inline Vec3<REAL>::LengthSquared() const -> REAL
+    constexpr auto inline Vec3<REAL>::LengthSquared() const -> REAL
     {
         return this->Dot((*this));
     }
@@ -0,0 +1,403 @@
+#pragma once
+
+#include <cmath>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "AlignedAllocator.hpp"
+#include "Error.hpp"
+#include "Vec3.hpp"
+
+/// @brief Promise that a pointer is the only way to access its data (supported by GCC, Clang and MSVC).
+#define FLIGHTPATH_RESTRICT __restrict
+
+namespace FlightPath
+{
+    /**
+     * @struct Vec3View
+     * @brief Non-owning view on three equally sized component columns (structure of arrays).
+     *
+     * @tparam T The element type, either REAL or const REAL.
+     */
+    template <typename T>
+    struct Vec3View
+    {
+        std::span<T> x; ///< The x-components.
+        std::span<T> y; ///< The y-components.
+        std::span<T> z; ///< The z-components.
+
+        /**
+         * @brief Returns the number of vectors in the view.
+         * @return The length of the component columns.
+         */
+        constexpr auto size() const -> size_t { return x.size(); }
+
+        /// @brief A mutable view converts implicitly to a read-only view.
+        constexpr operator Vec3View<const T>() const requires (!std::is_const_v<T>)
+        {
+            return Vec3View<const T>{.x = x, .y = y, .z = z};
+        }
+    };
+
+    namespace Detail
+    {
+        /// @brief Column-wise cross product. Restrict-qualified parameters, so the compiler vectorizes without overlap checks.
+        template <typename REAL>
+        auto inline CrossColumns(const REAL *FLIGHTPATH_RESTRICT ax, const REAL *FLIGHTPATH_RESTRICT ay, const REAL *FLIGHTPATH_RESTRICT az,
+                                 const REAL *FLIGHTPATH_RESTRICT bx, const REAL *FLIGHTPATH_RESTRICT by, const REAL *FLIGHTPATH_RESTRICT bz,
+                                 REAL *FLIGHTPATH_RESTRICT ox, REAL *FLIGHTPATH_RESTRICT oy, REAL *FLIGHTPATH_RESTRICT oz, const size_t n) -> void
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                ox[i] = ay[i]*bz[i] - az[i]*by[i];
+                oy[i] = az[i]*bx[i] - ax[i]*bz[i];
+                oz[i] = ax[i]*by[i] - ay[i]*bx[i];
+            }
+        }
+    }
+
+    /* Batch kernels over views. The REAL type is deduced from the output only, so
+       mutable and read-only views can be mixed freely for the inputs. Every loop works
+       on plain contiguous columns without dependencies between iterations, which the
+       compiler vectorizes (e.g. -O3 or /O2). Length and Normalize call std::sqrt, which
+       may set errno, so with GCC and Clang they only vectorize if the calling translation
+       unit is built with -fno-math-errno. */
+
+    /**
+     * @brief Component-wise addition out = a + b.
+     * @param a   The first operand.
+     * @param b   The second operand.
+     * @param out The result (may alias a or b).
+     * @throws FlightPath::Exception if the sizes do not match.
+     */
+    template <typename REAL>
+    auto inline Add(const Vec3View<const std::type_identity_t<REAL>> a, const Vec3View<const std::type_identity_t<REAL>> b, const Vec3View<REAL> out) -> void
+    {
+        const size_t n = out.size();
+        Ensure(a.size() == n && b.size() == n, "Vec3Array: Size mismatch {} + {} -> {}", a.size(), b.size(), n);
+
+        for (size_t i = 0; i < n; ++i) out.x[i] = a.x[i] + b.x[i];
+        for (size_t i = 0; i < n; ++i) out.y[i] = a.y[i] + b.y[i];
+        for (size_t i = 0; i < n; ++i) out.z[i] = a.z[i] + b.z[i];
+    }
+
+    /**
+     * @brief Component-wise subtraction out = a - b.
+     * @param a   The first operand.
+     * @param b   The second operand.
+     * @param out The result (may alias a or b).
+     * @throws FlightPath::Exception if the sizes do not match.
+     */
+    template <typename REAL>
+    auto inline Subtract(const Vec3View<const std::type_identity_t<REAL>> a, const Vec3View<const std::type_identity_t<REAL>> b, const Vec3View<REAL> out) -> void
+    {
+        const size_t n = out.size();
+        Ensure(a.size() == n && b.size() == n, "Vec3Array: Size mismatch {} - {} -> {}", a.size(), b.size(), n);
+
+        for (size_t i = 0; i < n; ++i) out.x[i] = a.x[i] - b.x[i];
+        for (size_t i = 0; i < n; ++i) out.y[i] = a.y[i] - b.y[i];
+        for (size_t i = 0; i < n; ++i) out.z[i] = a.z[i] - b.z[i];
+    }
+
+    /**
+     * @brief Multiplication of every vector with a scalar out = a * scalar.
+     * @param a      The vectors to scale.
+     * @param scalar The scale factor.
+     * @param out    The result (may alias a).
+     * @throws FlightPath::Exception if the sizes do not match.
+     */
+    template <typename REAL>
+    auto inline Scale(const Vec3View<const std::type_identity_t<REAL>> a, const std::type_identity_t<REAL> scalar, const Vec3View<REAL> out) -> void
+    {
+        const size_t n = out.size();
+        Ensure(a.size() == n, "Vec3Array: Size mismatch {} * s -> {}", a.size(), n);
+
+        for (size_t i = 0; i < n; ++i) out.x[i] = a.x[i] * scalar;
+        for (size_t i = 0; i < n; ++i) out.y[i] = a.y[i] * scalar;
+        for (size_t i = 0; i < n; ++i) out.z[i] = a.z[i] * scalar;
+    }
+
+    /**
+     * @brief Dot product of every pair of vectors out[i] = a[i] . b[i].
+     * @param a   The first operand.
+     * @param b   The second operand.
+     * @param out The dot products.
+     * @throws FlightPath::Exception if the sizes do not match.
+     */
+    template <typename REAL>
+    auto inline Dot(const Vec3View<const std::type_identity_t<REAL>> a, const Vec3View<const std::type_identity_t<REAL>> b, const std::span<REAL> out) -> void
+    {
+        const size_t n = out.size();
+        Ensure(a.size() == n && b.size() == n, "Vec3Array: Size mismatch {} . {} -> {}", a.size(), b.size(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            out[i] = a.x[i]*b.x[i] + a.y[i]*b.y[i] + a.z[i]*b.z[i];
+        }
+    }
+
+    /**
+     * @brief Cross product of every pair of vectors out[i] = a[i] x b[i].
+     * @param a   The first operand.
+     * @param b   The second operand.
+     * @param out The cross products (must not alias a or b).
+     * @throws FlightPath::Exception if the sizes do not match.
+     */
+    template <typename REAL>
+    auto inline Cross(const Vec3View<const std::type_identity_t<REAL>> a, const Vec3View<const std::type_identity_t<REAL>> b, const Vec3View<REAL> out) -> void
+    {
+        const size_t n = out.size();
+        Ensure(a.size() == n && b.size() == n, "Vec3Array: Size mismatch {} x {} -> {}", a.size(), b.size(), n);
+
+        Detail::CrossColumns(a.x.data(), a.y.data(), a.z.data(), b.x.data(), b.y.data(), b.z.data(), out.x.data(), out.y.data(), out.z.data(), n);
+    }
+
+    /**
+     * @brief Euclidean length of every vector out[i] = |a[i]|.
+     * @param a   The vectors.
+     * @param out The lengths.
+     * @throws FlightPath::Exception if the sizes do not match.
+     */
+    template <typename REAL>
+    auto inline Length(const Vec3View<const std::type_identity_t<REAL>> a, const std::span<REAL> out) -> void
+    {
+        const size_t n = out.size();
+        Ensure(a.size() == n, "Vec3Array: Size mismatch |{}| -> {}", a.size(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            out[i] = std::sqrt(a.x[i]*a.x[i] + a.y[i]*a.y[i] + a.z[i]*a.z[i]);
+        }
+    }
+
+    /**
+     * @brief Normalizes every vector in-place to unit length.
+     * @param a The vectors to normalize.
+     */
+    template <typename REAL>
+    auto inline Normalize(const Vec3View<REAL> a) -> void
+    {
+        const size_t n = a.size();
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const REAL inverse_length = REAL(1.0) / std::sqrt(a.x[i]*a.x[i] + a.y[i]*a.y[i] + a.z[i]*a.z[i]);
+            a.x[i] *= inverse_length;
+            a.y[i] *= inverse_length;
+            a.z[i] *= inverse_length;
+        }
+    }
+
+    /**
+     * @class Vec3Array
+     * @brief A batch of 3D vectors stored as separate, cache line aligned x, y and z columns.
+     *
+     * In contrast to a std::vector<Vec3>, the structure of arrays layout lets the compiler
+     * process several vectors per instruction, e.g. when computing `ab - ob.Cross(vb)` or
+     * drift metrics for a whole flight.
+     *
+     * @tparam REAL The real type (i.e. float or double) used for storage and operations.
+     */
+    template <typename REAL>
+    class Vec3Array
+    {
+    public:
+        using value_type = REAL;                                   ///< The type of the components.
+        using Column     = std::vector<REAL, AlignedAllocator<REAL>>; ///< Storage of one component.
+
+        /** @brief Default constructor. Creates an empty array. */
+        Vec3Array() = default;
+
+        /**
+         * @brief Creates an array of zero vectors.
+         * @param size The number of vectors.
+         */
+        explicit Vec3Array(const size_t size)
+            : x_(size, REAL(0)), y_(size, REAL(0)), z_(size, REAL(0))
+        {
+        }
+
+        /** @brief Default destructor. */
+        ~Vec3Array() = default;
+
+        /**
+         * @brief Gathers vectors from the members of a range of structs, e.g. the body accelerations of all entries.
+         *
+         * @param items The structs to read from.
+         * @param x     Pointer to the member holding the x-component.
+         * @param y     Pointer to the member holding the y-component.
+         * @param z     Pointer to the member holding the z-component.
+         * @return A new array with one vector per item.
+         */
+        template <typename T>
+        static auto Gather(const std::span<const T> items, REAL T::*x, REAL T::*y, REAL T::*z) -> Vec3Array
+        {
+            Vec3Array result(items.size());
+            for (size_t i = 0; i < items.size(); ++i)
+            {
+                result.x_[i] = items[i].*x;
+                result.y_[i] = items[i].*y;
+                result.z_[i] = items[i].*z;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Returns the number of vectors.
+         * @return The number of vectors.
+         */
+        auto size() const -> size_t { return x_.size(); }
+
+        /**
+         * @brief Resizes the array, new vectors are zero.
+         * @param size The new number of vectors.
+         */
+        auto Resize(const size_t size) -> void
+        {
+            x_.resize(size, REAL(0));
+            y_.resize(size, REAL(0));
+            z_.resize(size, REAL(0));
+        }
+
+        /**
+         * @brief Reserves storage without changing the size.
+         * @param capacity The number of vectors to reserve storage for.
+         */
+        auto Reserve(const size_t capacity) -> void
+        {
+            x_.reserve(capacity);
+            y_.reserve(capacity);
+            z_.reserve(capacity);
+        }
+
+        /**
+         * @brief Appends a vector.
+         * @param v The vector to append.
+         */
+        auto PushBack(const Vec3<REAL> &v) -> void
+        {
+            x_.push_back(v.x);
+            y_.push_back(v.y);
+            z_.push_back(v.z);
+        }
+
+        /**
+         * @brief Returns a copy of a single vector.
+         * @param index Index of the vector.
+         * @return The vector at index.
+         */
+        auto Get(const size_t index) const -> Vec3<REAL>
+        {
+            return Vec3<REAL>{.x = x_[index], .y = y_[index], .z = z_[index]};
+        }
+
+        /**
+         * @brief Overwrites a single vector.
+         * @param index Index of the vector.
+         * @param v     The new value.
+         */
+        auto Set(const size_t index, const Vec3<REAL> &v) -> void
+        {
+            x_[index] = v.x;
+            y_[index] = v.y;
+            z_[index] = v.z;
+        }
+
+        /// @brief Returns the x-components.
+        auto X() const -> std::span<const REAL> { return x_; }
+        /// @brief Returns the y-components.
+        auto Y() const -> std::span<const REAL> { return y_; }
+        /// @brief Returns the z-components.
+        auto Z() const -> std::span<const REAL> { return z_; }
+
+        /// @brief Returns a mutable view on all components.
+        auto View() -> Vec3View<REAL> { return Vec3View<REAL>{.x = x_, .y = y_, .z = z_}; }
+        /// @brief Returns a read-only view on all components.
+        auto View() const -> Vec3View<const REAL> { return Vec3View<const REAL>{.x = x_, .y = y_, .z = z_}; }
+
+        /**
+         * @brief Component-wise addition of two arrays of equal size.
+         * @param other The array to add.
+         * @return A new array containing the sums.
+         */
+        auto operator + (const Vec3Array &other) const -> Vec3Array
+        {
+            Vec3Array result(size());
+            FlightPath::Add<REAL>(View(), other.View(), result.View());
+            return result;
+        }
+
+        /**
+         * @brief Component-wise subtraction of two arrays of equal size.
+         * @param other The array to subtract.
+         * @return A new array containing the differences.
+         */
+        auto operator - (const Vec3Array &other) const -> Vec3Array
+        {
+            Vec3Array result(size());
+            FlightPath::Subtract<REAL>(View(), other.View(), result.View());
+            return result;
+        }
+
+        /**
+         * @brief Multiplies every vector by a scalar.
+         * @param scalar The scale factor.
+         * @return A new array containing the scaled vectors.
+         */
+        auto operator * (const REAL scalar) const -> Vec3Array
+        {
+            Vec3Array result(size());
+            FlightPath::Scale<REAL>(View(), scalar, result.View());
+            return result;
+        }
+
+        /**
+         * @brief Dot product with every vector of another array.
+         * @param other The other array.
+         * @return One dot product per vector.
+         */
+        auto Dot(const Vec3Array &other) const -> Column
+        {
+            Column result(size());
+            FlightPath::Dot<REAL>(View(), other.View(), result);
+            return result;
+        }
+
+        /**
+         * @brief Cross product with every vector of another array.
+         * @param other The other array.
+         * @return A new array containing the cross products.
+         */
+        auto Cross(const Vec3Array &other) const -> Vec3Array
+        {
+            Vec3Array result(size());
+            FlightPath::Cross<REAL>(View(), other.View(), result.View());
+            return result;
+        }
+
+        /**
+         * @brief Computes the Euclidean length of every vector.
+         * @return One length per vector.
+         */
+        auto Length() const -> Column
+        {
+            Column result(size());
+            FlightPath::Length<REAL>(View(), result);
+            return result;
+        }
+
+        /**
+         * @brief Normalizes all vectors in-place to unit length.
+         */
+        auto Normalize() -> void
+        {
+            FlightPath::Normalize<REAL>(View());
+        }
+
+    private:
+        Column x_; ///< The x-components.
+        Column y_; ///< The y-components.
+        Column z_; ///< The z-components.
+    };
+}
@@ -1,90 +1,297 @@
 #include <format>
+#include <optional>
+#include <sstream>
+#include <string>
 
 #include "Application.hpp"
+#include "BinaryLog.hpp"
+#include "KML.hpp"
+#include "KMLSink.hpp"
 #include "Log.hpp"
+#include "Profiler.hpp"
+#include "Trace.hpp"
 
 namespace FlightPath
 {
-    Application::Application()
+    // e.g. "integrate: IPC 2.41, per sample: 612.0 cycles, 1476.3 instructions, 3.1 L1d misses, ..."
+    static auto LogPerfPhase(const PerfPhase &phase) -> void
     {
+        const auto ipc = phase.sample.GetIPC();
+        std::string message = std::format("{}: IPC {}, per sample:", phase.name, ipc ? std::format("{:.2f}", *ipc) : "n/a");
+        for (size_t i = 0; i < PerfEventCount; ++i)
+        {
+            const auto event = static_cast<PerfEvent>(i);
+            const auto value = phase.sample.GetPer(event, phase.samples);
+            message += std::format("{} {} {}", i == 0 ? "" : ",", value ? std::format("{:.1f}", *value) : "n/a", GetName(event));
+        }
+        Log::Info(message);
+    }
+
+    // distance between the reconstructed and the logged position in m
+    static auto GetDivergence(const Position &position, const Entry &entry) -> double
+    {
+        const Position logged{.longitude = entry.longitude, .latitude = entry.latitude, .altitude = entry.altitude};
+        return (ReferenceFrame::GetEarthCoordinates(position) - ReferenceFrame::GetEarthCoordinates(logged)).Length();
+    }
+
+    // e.g. "integrate: 412.0 bytes per sample (input 12.4 MiB, output 12.4 MiB, transient 0.1 MiB), peak RSS 40.2 MiB"
+    static auto LogMemoryPhase(const MemoryPhase &phase) -> void
+    {
+        constexpr double MiB = 1024.0 * 1024.0;
+        Log::Info("{}: {:.1f} bytes per sample (input {:.1f} MiB, output {:.1f} MiB, transient {:.1f} MiB), peak RSS {}",
+            phase.name, phase.GetBytesPerSample(),
+            static_cast<double>(phase.input_bytes) / MiB, static_cast<double>(phase.output_bytes) / MiB, static_cast<double>(phase.transient_bytes) / MiB,
+            phase.resident_peak == 0 ? std::string("n/a") : std::format("{:.1f} MiB{}", static_cast<double>(phase.resident_peak) / MiB, phase.resident_reset ? "" : " (process)"));
+    }
+
+    Application::Application(const ApplicationSettings &settings)
+        : settings_(settings)
+    {
+        if (settings_.perf_counters)
+        {
+            perf_counters_.emplace();
+            if (!perf_counters_->IsAvailable())
+            {
+                Log::Warn("Hardware performance counters unavailable ({}), continuing without", perf_counters_->GetError());
+                perf_counters_.reset();
+            }
+        }
+
+        if (settings_.drift_sample_interval > 0)
+        {
+            drift_.emplace(settings_.drift_sample_interval);
+        }
+
+        if (!settings_.trace_path.empty())
+        {
+            trace_session_.emplace(settings_.trace_path);
+        }
+
         Log::Info("Reading flight data file...");
-        recorder_.ReadFile("./data/Graz-Gleichenberg.txt");
+        recorder_.SetRetainOutput(settings_.retain_output || !settings_.lod_directory.empty() || !settings_.columnar_path.empty());
+        {
+            Profiler::Scope scope("parse");
+            BeginMemoryPhase();
+            if (perf_counters_) perf_counters_->Start();
+            recorder_.ReadFile(settings_.input_path);
+            recorder_.ReserveOutput(recorder_.GetData().size());
+            if (perf_counters_) perf_report_.push_back({.name = "read", .samples = recorder_.GetData().size(), .sample = perf_counters_->Stop()});
+            EndMemoryPhase("read", recorder_.GetData().size());
+        }
         const auto& data = recorder_.GetData();
-        Log::Info(std::format("Reading flight data file... Done {} entries.", data.size()));
+        Log::Info("Reading flight data file... Done {} entries.", data.size());
+
+        Profiler::Scope scope("init");
+        if (!settings_.store_path.empty())
+        {
+            Log::Info("Opening trajectory store...");
+            recorder_.OpenStore(settings_.store_path);
+            Log::Info("Opening trajectory store... Done");
+        }
         
         Log::Info("Initializing reference frame...");
-        const auto &entry = data[0];
-        reference_frame_.SetPosition(
-            Position{
-                .longitude = entry.longitude,
-                .latitude  = entry.latitude,
-                .altitude  = entry.altitude}
-        );
-
-        reference_frame_.SetAttitude(
-            Attitude{
-                .heading = entry.true_heading, 
-                .pitch   = entry.pitch,    
-                .roll    = entry.roll}
-        );
+        reconstructor_.Reset(GetInitialState(data[0]));
         Log::Info("Initializing reference frame... Done");
-        reference_frame_.PrintPosition();
-        reference_frame_.PrintAttitude();
+        reconstructor_.GetFrame().PrintPosition();
+        reconstructor_.GetFrame().PrintAttitude();
 
         Log::Info("Initializing aircraft velocity... Done");
-        vb_np1_ = Vec3(entry.v_x, entry.v_y, entry.v_z);
     }
 
     auto Application::Run() -> void
     {
         const auto& data = recorder_.GetData();
-        const Mat4<double> eye_4{
-            1.0, 0.0, 0.0, 0.0,
-            0.0, 1.0, 0.0, 0.0,
-            0.0, 0.0, 1.0, 0.0,
-            0.0, 0.0, 0.0, 1.0
-        };
         
+        // the original track is known up front, the reconstructed one is streamed while it is calculated
+        std::optional<Profiler::Scope> scope(std::in_place, "export");
+        KMLSink sink(settings_.kml_path, settings_.kml_tolerance);
+        {
+            Profiler::Scope kml_scope("kml");
+            Trace::Span span("KML export");
+            sink.WriteTrack(KML::OpenOriginalDataset, data);
+            sink.BeginTrack(KML::OpenReconstructedDataset);
+            sink.Push(data[0]);
+        }
+
+        if (!settings_.diagnostics_path.empty())
+        {
+            BinaryLog::Open(settings_.diagnostics_path);
+        }
+
         Log::Info("Calculating flight path...");
+        scope.emplace("reconstruct");
+        Trace::Span reconstruct_span("reconstruct");
+        BeginMemoryPhase();
+        if (perf_counters_) perf_counters_->Start();
         for (size_t idx = 0; idx < data.size() - 1; ++idx)
         {
-            vb_n_ = vb_np1_;
+            // one phase after the other, emplace ends the previous one
+            std::optional<Profiler::Scope> step_scope(std::in_place, "integrate");
 
-            // calculate acceleration (ab and ob comes from logfile)
+            // integration yields velocity and new position + attitude (ab and ob comes from logfile)
             const Vec3<double> ab = Vec3<double>(data[idx].a_x,     data[idx].a_y,     data[idx].a_z);
             const Vec3<double> ob = Vec3<double>(data[idx].omega_x, data[idx].omega_y, data[idx].omega_z);
             const double dt = data[idx+1].time - data[idx].time;
+            reconstructor_.Integrate(ab, ob, dt);
+
+            // the drift of the uncorrected transform, only every n-th step as the errors cost about as much as the correction
+            const bool sample_drift = drift_ && drift_->ShouldSample();
+            DriftSample drift_sample{};
+            if (sample_drift)
+            {
+                drift_sample.orthogonal_error = reconstructor_.GetFrame().GetOrthogonalError();
+                drift_sample.length_error     = reconstructor_.GetFrame().GetLengthError();
+            }
 
-            const Vec3<double> dv_dt_b = ab - ob.Cross(vb_n_);
+            // correct the transform
+            step_scope.emplace("orthonormalize");
+            const i32 iterations = reconstructor_.Orthonormalize();
 
-            const Mat4<double> twist_matrix = {
-                  0.0, -ob.z,  ob.y, vb_n_.x,
-                 ob.z,   0.0, -ob.x, vb_n_.y,
-                -ob.y,  ob.x,   0.0, vb_n_.z,
-                  0.0,   0.0,   0.0,     0.0
-            };
+            step_scope.emplace("pose");
+            const Position position = reconstructor_.GetPosition();
+            const Attitude attitude = reconstructor_.GetAttitude();
 
-            // integration yields velocity and new position + attitude
-            vb_np1_ = vb_n_ + dv_dt_b * dt;
-            reference_frame_.Dot(eye_4 + twist_matrix * dt);
+            if (drift_)
+            {
+                drift_->AddIterations(iterations);
+                if (sample_drift)
+                {
+                    drift_sample.dt         = dt;
+                    drift_sample.divergence = GetDivergence(position, data[idx+1]);
+                    drift_->Add(drift_sample);
+                }
+            }
 
-            // correct the transform
-            reference_frame_.Orthonormalize();
+            // store flight data in recorder and export it
+            step_scope.emplace("record");
+            sink.Push(recorder_.WriteData(position, attitude, reconstructor_.GetVelocity()));
 
-            // store flight data in recorder
-            recorder_.WriteData(
-                reference_frame_.GetPosition(), 
-                reference_frame_.GetAttitude(),
-                vb_np1_
-            );
+            if (!settings_.diagnostics_path.empty())
+            {
+                BinaryLog::Write<"t={:.2f} dt={:.4f} ortho={:.3e} |vb|={:.3f} lon={:.9f} lat={:.9f} alt={:.1f} hdg={:.4f} pitch={:.4f} roll={:.4f}">(
+                    data[idx+1].time, dt, reconstructor_.GetFrame().GetOrthogonalError(), reconstructor_.GetVelocity().Length(),
+                    position.longitude, position.latitude, position.altitude,
+                    attitude.heading, attitude.pitch, attitude.roll);
+            }
         }
+        if (perf_counters_) perf_report_.push_back({.name = "integrate", .samples = data.size() - 1, .sample = perf_counters_->Stop()});
+        EndMemoryPhase("integrate", data.size() - 1);
+        BinaryLog::Close();
+        reconstruct_span.End();
+        sink.EndTrack();
         Log::Info("Calculating flight path... Done");
         Log::Info("Final Position:");
-        reference_frame_.PrintPosition();
-        reference_frame_.PrintAttitude();
+        reconstructor_.GetFrame().PrintPosition();
+        reconstructor_.GetFrame().PrintAttitude();
         
+        scope.emplace("export");
+        BeginMemoryPhase();
+        if (perf_counters_) perf_counters_->Start();
         Log::Info("Exporting KML file...");
-        recorder_.DumpKML("./data/Graz-Gleichenberg.kml");
+        {
+            Profiler::Scope kml_scope("kml");
+            Trace::Span span("KML export");
+            sink.Close();
+        }
         Log::Info("Exporting KML file... Done");
+
+        if (!settings_.lod_directory.empty())
+        {
+            Log::Info("Exporting level of detail KML files...");
+            Profiler::Scope lod_scope("lod");
+            Trace::Span span("LOD export");
+            recorder_.DumpLodKML(settings_.lod_directory, settings_.lod_settings);
+            Log::Info("Exporting level of detail KML files... Done");
+        }
+
+        if (!settings_.columnar_path.empty())
+        {
+            Log::Info("Exporting columnar file...");
+            Profiler::Scope columnar_scope("columnar");
+            Trace::Span span("columnar export");
+            recorder_.DumpColumnar(settings_.columnar_path);
+            Log::Info("Exporting columnar file... Done");
+        }
+        if (perf_counters_) perf_report_.push_back({.name = "export", .samples = data.size(), .sample = perf_counters_->Stop()});
+        EndMemoryPhase("export", data.size());
+        scope.reset();
+
+        if (trace_session_) trace_session_->Close();
+
+        if (drift_)
+        {
+            std::stringstream summary;
+            drift_->WriteSummary(summary);
+
+            Log::Info("Numerical drift:");
+            std::string line;
+            while (std::getline(summary, line))
+            {
+                Log::Info(line);
+            }
+        }
+
+        if (!memory_report_.empty())
+        {
+            Log::Info("Memory:");
+            for (const auto &phase : memory_report_)
+            {
+                LogMemoryPhase(phase);
+            }
+        }
+
+        if (!perf_report_.empty())
+        {
+            Log::Info("Hardware performance counters:");
+            for (const auto &phase : perf_report_)
+            {
+                LogPerfPhase(phase);
+            }
+        }
+
+        if constexpr (Profiler::Enabled)
+        {
+            std::stringstream summary;
+            Profiler::WriteSummary(summary);
+
+            Log::Info("Phase timings:");
+            std::string line;
+            while (std::getline(summary, line))
+            {
+                Log::Info(line);
+            }
+
+            if (!settings_.profile_path.empty())
+            {
+                Profiler::WriteJSON(settings_.profile_path);
+            }
+        }
+        else if (!settings_.profile_path.empty())
+        {
+            Log::Warn("No phase timings to write, profiling is not compiled in (ENABLE_PROFILING)");
+        }
+    }
+
+    auto Application::BeginMemoryPhase() -> void
+    {
+        if (!settings_.memory_report) return;
+
+        resident_reset_ = ResetPeakResidentMemory();
+        recorder_.ResetMemoryPeaks();
+        GetTransientMemory().ResetPeak();
+    }
+
+    auto Application::EndMemoryPhase(const std::string &name, const size_t samples) -> void
+    {
+        if (!settings_.memory_report) return;
+
+        memory_report_.push_back({
+            .name            = name,
+            .samples         = samples,
+            .input_bytes     = recorder_.GetInputMemory().GetPeak(),
+            .output_bytes    = recorder_.GetOutputMemory().GetPeak(),
+            .transient_bytes = GetTransientMemory().GetPeak(),
+            .resident_peak   = GetResidentMemory().peak,
+            .resident_reset  = resident_reset_});
     }
 }
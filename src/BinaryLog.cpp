@@ -0,0 +1,351 @@
+#include "BinaryLog.hpp"
+
+#include <bit>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace FlightPath::BinaryLog
+{
+    static constexpr uint32_t ByteOrderMark = 0x01020304;
+
+    struct ThreadBuffer;
+
+    // a registered format string
+    struct FormatInfo
+    {
+        std::string          format;
+        std::vector<ArgType> types;
+    };
+
+    // the open file, the registered formats and the buffers of all threads
+    // note: formats stay registered across sessions, the call sites cache their ids
+    struct Session
+    {
+        std::mutex                 mutex;
+        std::ofstream              file;
+        std::vector<FormatInfo>    formats;
+        size_t                     written_formats = 0; ///< Formats already defined in the current file.
+        std::vector<ThreadBuffer*> buffers;
+        uint32_t                   next_thread = 0;
+    };
+
+    static auto GetSession() -> Session&
+    {
+        static Session session;
+        return session;
+    }
+
+    template <typename T>
+    static auto WriteValue(std::ofstream &file, const T value) -> void
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    // defines all formats registered since the last flush, the lock must be held
+    static auto WriteFormats(Session &session) -> void
+    {
+        for (; session.written_formats < session.formats.size(); ++session.written_formats)
+        {
+            const auto &info = session.formats[session.written_formats];
+            WriteValue(session.file, ChunkType::Format);
+            WriteValue(session.file, static_cast<uint32_t>(session.written_formats));
+            WriteValue(session.file, static_cast<uint8_t>(info.types.size()));
+            session.file.write(reinterpret_cast<const char*>(info.types.data()), static_cast<std::streamsize>(info.types.size()));
+            WriteValue(session.file, static_cast<uint32_t>(info.format.size()));
+            session.file.write(info.format.data(), static_cast<std::streamsize>(info.format.size()));
+        }
+    }
+
+    struct ThreadBuffer
+    {
+        uint32_t index = 0;
+        Detail::ThreadCursor *cursor = nullptr; ///< The cursor of the owning thread.
+        std::array<std::byte, BufferSize> data;
+
+        ThreadBuffer()
+            : cursor(&Detail::cursor)
+        {
+            auto &session = GetSession();
+            const std::lock_guard lock(session.mutex);
+            index = session.next_thread++;
+            session.buffers.push_back(this);
+
+            cursor->position = data.data();
+            cursor->end      = data.data() + data.size();
+        }
+
+        // records of a thread that ends during a session are not lost
+        ~ThreadBuffer()
+        {
+            auto &session = GetSession();
+            const std::lock_guard lock(session.mutex);
+            Flush(session);
+            std::erase(session.buffers, this);
+
+            cursor->position = nullptr;
+            cursor->end      = nullptr;
+        }
+
+        // appends the buffer as a chunk, the lock must be held
+        auto Flush(Session &session) -> void
+        {
+            const auto size = static_cast<size_t>(cursor->position - data.data());
+            if (size > 0 && session.file.is_open())
+            {
+                WriteFormats(session);
+                WriteValue(session.file, ChunkType::Records);
+                WriteValue(session.file, index);
+                WriteValue(session.file, static_cast<uint32_t>(size));
+                session.file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(size));
+            }
+            cursor->position = data.data();
+        }
+    };
+
+    auto Open(const std::string &path) -> void
+    {
+        auto &session = GetSession();
+        const std::lock_guard lock(session.mutex);
+        Ensure(!session.file.is_open(), "BinaryLog: A session is already open");
+
+        session.file.open(path, std::ios::binary | std::ios::trunc);
+        Ensure(session.file.is_open(), "BinaryLog: Could not open file {}", path);
+
+        session.file.write(Magic.data(), Magic.size());
+        WriteValue(session.file, Version);
+        WriteValue(session.file, ByteOrderMark);
+        session.written_formats = 0;
+
+        Detail::enabled.store(true, std::memory_order_release);
+    }
+
+    auto Close() -> void
+    {
+        auto &session = GetSession();
+        const std::lock_guard lock(session.mutex);
+        if (!session.file.is_open()) return;
+
+        Detail::enabled.store(false, std::memory_order_release);
+        for (auto *buffer : session.buffers)
+        {
+            buffer->Flush(session);
+        }
+
+        session.file.close();
+        Ensure(!session.file.fail(), "BinaryLog: Could not write log file");
+    }
+
+    auto Register(const std::string_view format, const std::span<const ArgType> types) -> uint32_t
+    {
+        auto &session = GetSession();
+        const std::lock_guard lock(session.mutex);
+        session.formats.push_back(FormatInfo{.format = std::string(format), .types = {types.begin(), types.end()}});
+        return static_cast<uint32_t>(session.formats.size() - 1);
+    }
+
+    namespace Detail
+    {
+        auto Reserve(const size_t size) -> void
+        {
+            Ensure(size <= BufferSize, "BinaryLog: Record of {} bytes does not fit into a buffer", size);
+
+            // allocated on first use, so threads that never record do not pay for a buffer
+            thread_local std::unique_ptr<ThreadBuffer> buffer;
+            if (!buffer)
+            {
+                buffer = std::make_unique<ThreadBuffer>();
+            }
+
+            if (static_cast<size_t>(cursor.end - cursor.position) < size)
+            {
+                auto &session = GetSession();
+                const std::lock_guard lock(session.mutex);
+                buffer->Flush(session);
+            }
+        }
+    }
+
+    // bounds checked reading of a loaded log file
+    class Cursor
+    {
+    public:
+        explicit Cursor(const std::vector<char> &data) : data_(data) {}
+
+        auto AtEnd() const -> bool { return position_ == data_.size(); }
+
+        template <typename T>
+        auto Read() -> T
+        {
+            T value;
+            std::memcpy(&value, Take(sizeof(T)), sizeof(T));
+            return value;
+        }
+
+        auto Take(const size_t size) -> const char*
+        {
+            Ensure(size <= data_.size() - position_, "BinaryLog: File is truncated at byte {}", position_);
+            const char *start = data_.data() + position_;
+            position_ += size;
+            return start;
+        }
+
+    private:
+        const std::vector<char> &data_;
+        size_t position_ = 0;
+    };
+
+    // one decoded argument
+    struct Value
+    {
+        ArgType  type;
+        uint64_t bits;
+    };
+
+    // formats a single argument with a format spec (the text between ':' and '}')
+    static auto FormatValue(const Value value, const std::string_view spec) -> std::string
+    {
+        const std::string format = std::format("{{:{}}}", spec);
+        switch (value.type)
+        {
+            case ArgType::Int64:   { const int64_t v = std::bit_cast<int64_t>(value.bits); return std::vformat(format, std::make_format_args(v)); }
+            case ArgType::UInt64:  { const uint64_t v = value.bits;                        return std::vformat(format, std::make_format_args(v)); }
+            case ArgType::Float64: { const double v = std::bit_cast<double>(value.bits);   return std::vformat(format, std::make_format_args(v)); }
+            case ArgType::Bool:    { const bool v = value.bits != 0;                       return std::vformat(format, std::make_format_args(v)); }
+        }
+        throw Exception(std::format("BinaryLog: Invalid argument type {}", static_cast<int>(value.type)));
+    }
+
+    // renders a format string with automatically numbered replacement fields
+    static auto Render(const std::string_view format, const std::span<const Value> values) -> std::string
+    {
+        std::string text;
+        size_t next = 0;
+        for (size_t i = 0; i < format.size(); ++i)
+        {
+            const char c = format[i];
+            if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c)
+            {
+                text += c;
+                ++i;
+            }
+            else if (c == '{')
+            {
+                const size_t close = format.find('}', i);
+                Ensure(close != std::string_view::npos, "BinaryLog: Unterminated replacement field in '{}'", format);
+                Ensure(next < values.size(), "BinaryLog: Too few arguments for '{}'", format);
+
+                const std::string_view field = format.substr(i + 1, close - i - 1);
+                const size_t colon = field.find(':');
+                text += FormatValue(values[next++], colon == std::string_view::npos ? std::string_view() : field.substr(colon + 1));
+                i = close;
+            }
+            else
+            {
+                text += c;
+            }
+        }
+        return text;
+    }
+
+    static auto WriteCSVRow(std::ostream &output, const uint32_t thread, const uint32_t id, const std::string_view format, const std::span<const Value> values) -> void
+    {
+        output << thread << ',' << id << ",\"";
+        for (const char c : format)
+        {
+            output << c;
+            if (c == '"') output << '"';
+        }
+        output << '"';
+        for (const auto &value : values)
+        {
+            output << ',' << FormatValue(value, "");
+        }
+        output << '\n';
+    }
+
+    auto Decode(const std::string &path, std::ostream &output, const Output format) -> size_t
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        Ensure(file.is_open(), "BinaryLog: Could not open file {}", path);
+
+        std::vector<char> data(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(data.data(), static_cast<std::streamsize>(data.size()));
+        Ensure(file.good(), "BinaryLog: Could not read file {}", path);
+
+        Cursor cursor(data);
+        std::array<char, 8> magic;
+        std::memcpy(magic.data(), cursor.Take(magic.size()), magic.size());
+        Ensure(magic == Magic, "BinaryLog: Not a FlightPath binary log");
+        const auto version = cursor.Read<uint32_t>();
+        Ensure(version == Version, "BinaryLog: Unsupported version {}", version);
+        Ensure(cursor.Read<uint32_t>() == ByteOrderMark, "BinaryLog: File was written with a different byte order");
+
+        if (format == Output::CSV)
+        {
+            output << "thread,format_id,format,values\n";
+        }
+
+        std::vector<FormatInfo> formats;
+        std::vector<Value> values;
+        size_t count = 0;
+        while (!cursor.AtEnd())
+        {
+            const auto chunk = cursor.Read<ChunkType>();
+            if (chunk == ChunkType::Format)
+            {
+                const auto id = cursor.Read<uint32_t>();
+                Ensure(id == formats.size(), "BinaryLog: Unexpected format id {}", id);
+
+                FormatInfo info;
+                info.types.resize(cursor.Read<uint8_t>());
+                std::memcpy(info.types.data(), cursor.Take(info.types.size()), info.types.size());
+                const auto length = cursor.Read<uint32_t>();
+                info.format.assign(cursor.Take(length), length);
+                formats.push_back(std::move(info));
+            }
+            else if (chunk == ChunkType::Records)
+            {
+                const auto thread = cursor.Read<uint32_t>();
+                const auto size   = cursor.Read<uint32_t>();
+                const char *start = cursor.Take(size);
+                const std::vector<char> records(start, start + size);
+                Cursor record_cursor(records);
+
+                while (!record_cursor.AtEnd())
+                {
+                    const auto id = record_cursor.Read<uint32_t>();
+                    Ensure(id < formats.size(), "BinaryLog: Undefined format id {}", id);
+                    const auto &info = formats[id];
+
+                    values.clear();
+                    for (const auto type : info.types)
+                    {
+                        values.push_back(Value{.type = type, .bits = record_cursor.Read<uint64_t>()});
+                    }
+
+                    if (format == Output::Text)
+                    {
+                        output << 'T' << thread << ' ' << Render(info.format, values) << '\n';
+                    }
+                    else
+                    {
+                        WriteCSVRow(output, thread, id, info.format, values);
+                    }
+                    ++count;
+                }
+            }
+            else
+            {
+                throw Exception(std::format("BinaryLog: Invalid chunk type {}", static_cast<int>(chunk)));
+            }
+        }
+        return count;
+    }
+}
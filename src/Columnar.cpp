@@ -0,0 +1,265 @@
+#include "Columnar.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <type_traits>
+
+#include "Error.hpp"
+
+namespace FlightPath::Columnar
+{
+    static constexpr Field EntryFields[] = {
+        {.name = "time",         .unit = "s",      .member = &Entry::time},
+        {.name = "longitude",    .unit = "rad",    .member = &Entry::longitude},
+        {.name = "latitude",     .unit = "rad",    .member = &Entry::latitude},
+        {.name = "altitude",     .unit = "m",      .member = &Entry::altitude},
+        {.name = "true_heading", .unit = "rad",    .member = &Entry::true_heading},
+        {.name = "pitch",        .unit = "rad",    .member = &Entry::pitch},
+        {.name = "roll",         .unit = "rad",    .member = &Entry::roll},
+        {.name = "v_x",          .unit = "m/s",    .member = &Entry::v_x},
+        {.name = "v_y",          .unit = "m/s",    .member = &Entry::v_y},
+        {.name = "v_z",          .unit = "m/s",    .member = &Entry::v_z},
+        {.name = "omega_x",      .unit = "rad/s",  .member = &Entry::omega_x},
+        {.name = "omega_y",      .unit = "rad/s",  .member = &Entry::omega_y},
+        {.name = "omega_z",      .unit = "rad/s",  .member = &Entry::omega_z},
+        {.name = "a_x",          .unit = "m/s2",   .member = &Entry::a_x},
+        {.name = "a_y",          .unit = "m/s2",   .member = &Entry::a_y},
+        {.name = "a_z",          .unit = "m/s2",   .member = &Entry::a_z},
+    };
+
+    static constexpr auto AlignUp(const uint64_t value) -> uint64_t
+    {
+        return (value + Alignment - 1) / Alignment * Alignment;
+    }
+
+    template <typename T>
+    static auto ByteSwap(T &value) -> void
+    {
+        if constexpr (std::is_enum_v<T>)
+        {
+            value = static_cast<T>(std::byteswap(static_cast<std::underlying_type_t<T>>(value)));
+        }
+        else
+        {
+            value = std::byteswap(value);
+        }
+    }
+
+    // files are little-endian, the Swap functions convert in place between native and file order on big-endian machines
+    static constexpr bool IsBigEndian = std::endian::native == std::endian::big;
+
+    static auto SwapHeader(Header &header) -> void
+    {
+        ByteSwap(header.version);       ByteSwap(header.column_count);
+        ByteSwap(header.row_count);     ByteSwap(header.capacity);
+        ByteSwap(header.schema_offset); ByteSwap(header.data_offset);
+        ByteSwap(header.file_size);
+    }
+
+    // note: native is the header in native order, its schema bounds must have been validated
+    static auto SwapSchema(const std::span<std::byte> data, const Header &native) -> void
+    {
+        auto *schema = reinterpret_cast<ColumnDescriptor*>(data.data() + native.schema_offset);
+        for (uint32_t c = 0; c < native.column_count; ++c)
+        {
+            ByteSwap(schema[c].type); ByteSwap(schema[c].element_size); ByteSwap(schema[c].offset);
+        }
+    }
+
+    // note: header and schema must be in native order and validated
+    static auto SwapColumns(const std::span<std::byte> data, const Header &native) -> void
+    {
+        const auto *schema = reinterpret_cast<const ColumnDescriptor*>(data.data() + native.schema_offset);
+        for (uint32_t c = 0; c < native.column_count; ++c)
+        {
+            auto *values = reinterpret_cast<uint64_t*>(data.data() + schema[c].offset);
+            for (uint64_t row = 0; row < native.capacity; ++row) ByteSwap(values[row]);
+        }
+    }
+
+    auto GetEntryFields() -> std::span<const Field>
+    {
+        return EntryFields;
+    }
+
+    // header of a file for Entry data with the given capacity
+    static auto GetEntryHeader(const uint64_t capacity) -> Header
+    {
+        const auto fields = GetEntryFields();
+
+        Header header{};
+        header.magic         = Magic;
+        header.version       = Version;
+        header.column_count  = static_cast<uint32_t>(fields.size());
+        header.row_count     = 0;
+        header.capacity      = capacity;
+        header.schema_offset = sizeof(Header);
+        header.data_offset   = AlignUp(header.schema_offset + fields.size() * sizeof(ColumnDescriptor));
+        header.file_size     = header.data_offset + fields.size() * AlignUp(capacity * sizeof(double));
+        return header;
+    }
+
+    auto GetEntryFileSize(const uint64_t capacity) -> uint64_t
+    {
+        return GetEntryHeader(capacity).file_size;
+    }
+
+    auto InitializeEntryFile(const std::span<std::byte> data, const uint64_t capacity) -> void
+    {
+        const auto fields = GetEntryFields();
+        const Header header = GetEntryHeader(capacity);
+        Ensure(data.size() >= header.file_size, "Columnar: Buffer too small ({} of {} bytes)", data.size(), header.file_size);
+
+        for (size_t c = 0; c < fields.size(); ++c)
+        {
+            ColumnDescriptor column{};
+            std::copy_n(fields[c].name.begin(), std::min(fields[c].name.size(), column.name.size() - 1), column.name.begin());
+            std::copy_n(fields[c].unit.begin(), std::min(fields[c].unit.size(), column.unit.size() - 1), column.unit.begin());
+            column.type         = ColumnType::Float64;
+            column.element_size = sizeof(double);
+            column.offset       = header.data_offset + c * AlignUp(capacity * sizeof(double));
+            std::memcpy(data.data() + header.schema_offset + c * sizeof(ColumnDescriptor), &column, sizeof(column));
+        }
+
+        // header last, a concurrent reader sees either no magic or a complete schema
+        std::memcpy(data.data(), &header, sizeof(header));
+    }
+
+    auto FindColumn(const std::span<const std::byte> data, const std::string_view name) -> const double*
+    {
+        const auto &header = *reinterpret_cast<const Header*>(data.data());
+        const auto *schema = reinterpret_cast<const ColumnDescriptor*>(data.data() + header.schema_offset);
+
+        for (uint32_t c = 0; c < header.column_count; ++c)
+        {
+            const auto end = std::find(schema[c].name.begin(), schema[c].name.end(), '\0');
+            if (name == std::string_view(schema[c].name.begin(), end))
+            {
+                return reinterpret_cast<const double*>(data.data() + schema[c].offset);
+            }
+        }
+        throw Exception(std::format("Columnar: No column named {}", name));
+    }
+
+    // checks the header, afterwards the schema lies within the data
+    static auto ValidateHeader(const std::span<const std::byte> data) -> void
+    {
+        Ensure(data.size() >= sizeof(Header), "Columnar: File is too small ({} bytes)", data.size());
+
+        const auto &header = *reinterpret_cast<const Header*>(data.data());
+        Ensure(header.magic == Magic, "Columnar: Not a FlightPath columnar file");
+        Ensure(header.version == Version, "Columnar: Unsupported version {}", header.version);
+        Ensure(header.row_count <= header.capacity, "Columnar: Invalid row count {} > {}", header.row_count, header.capacity);
+        Ensure(header.file_size <= data.size(), "Columnar: File is truncated ({} of {} bytes)", data.size(), header.file_size);
+
+        // the bounds are checked by subtraction and division, crafted offsets and counts could wrap a sum or a product
+        Ensure(header.schema_offset >= sizeof(Header) && header.schema_offset % alignof(ColumnDescriptor) == 0, "Columnar: Invalid schema offset {}", header.schema_offset);
+        Ensure(header.schema_offset <= header.data_offset && header.data_offset <= header.file_size, "Columnar: Invalid data offset {}", header.data_offset);
+        Ensure(header.column_count <= (header.data_offset - header.schema_offset) / sizeof(ColumnDescriptor), "Columnar: Invalid column count {}", header.column_count);
+    }
+
+    // checks the schema of a validated header, afterwards every column lies within the data
+    static auto ValidateSchema(const std::span<const std::byte> data) -> void
+    {
+        const auto &header = *reinterpret_cast<const Header*>(data.data());
+        const auto *schema = reinterpret_cast<const ColumnDescriptor*>(data.data() + header.schema_offset);
+        for (uint32_t c = 0; c < header.column_count; ++c)
+        {
+            Ensure(schema[c].type == ColumnType::Float64 && schema[c].element_size == sizeof(double), "Columnar: Unsupported type of column {}", c);
+            Ensure(schema[c].offset % Alignment == 0 && schema[c].offset >= header.data_offset && schema[c].offset <= header.file_size, "Columnar: Invalid offset of column {}", c);
+            Ensure(header.capacity <= (header.file_size - schema[c].offset) / sizeof(double), "Columnar: Column {} exceeds the file", c);
+        }
+    }
+
+    auto Validate(const std::span<const std::byte> data) -> void
+    {
+        ValidateHeader(data);
+        ValidateSchema(data);
+    }
+
+    auto Write(const std::string &path, const std::span<const Entry> entries) -> void
+    {
+        std::vector<std::byte, AlignedAllocator<std::byte, Alignment>> data(GetEntryFileSize(entries.size()));
+        InitializeEntryFile(data, entries.size());
+        auto &header = *reinterpret_cast<Header*>(data.data());
+        header.row_count = entries.size();
+
+        const auto fields = GetEntryFields();
+        const auto *schema = reinterpret_cast<const ColumnDescriptor*>(data.data() + header.schema_offset);
+        for (size_t c = 0; c < fields.size(); ++c)
+        {
+            auto *values = reinterpret_cast<double*>(data.data() + schema[c].offset);
+            for (size_t row = 0; row < entries.size(); ++row)
+            {
+                values[row] = entries[row].*fields[c].member;
+            }
+        }
+
+        if constexpr (IsBigEndian)
+        {
+            // the native header and schema locate the columns, so they are converted last
+            SwapColumns(data, header);
+            SwapSchema(data, header);
+            SwapHeader(header);
+        }
+
+        std::ofstream file(path, std::ios::binary);
+        Ensure(file.is_open(), "Columnar: Could not open file {}", path);
+
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        Ensure(file.good(), "Columnar: Could not write file {}", path);
+    }
+
+    Reader::Reader(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        Ensure(file.is_open(), "Columnar: Could not open file {}", path);
+
+        data_.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data_.data()), static_cast<std::streamsize>(data_.size()));
+        Ensure(file.good(), "Columnar: Could not read file {}", path);
+
+        // on big-endian machines only the fixed size header is converted before it is validated,
+        // schema and columns are converted once the offsets they are found at are known to be valid
+        auto &header = *reinterpret_cast<Header*>(data_.data());
+        if constexpr (IsBigEndian)
+        {
+            if (data_.size() >= sizeof(Header)) SwapHeader(header);
+        }
+        ValidateHeader(data_);
+
+        if constexpr (IsBigEndian) SwapSchema(data_, header);
+        ValidateSchema(data_);
+
+        if constexpr (IsBigEndian) SwapColumns(data_, header);
+    }
+
+    auto Reader::GetSchema() const -> std::span<const ColumnDescriptor>
+    {
+        const auto &header = GetHeader();
+        return {reinterpret_cast<const ColumnDescriptor*>(data_.data() + header.schema_offset), header.column_count};
+    }
+
+    auto Reader::GetColumn(const std::string_view name) const -> std::span<const double>
+    {
+        return {FindColumn(data_, name), GetHeader().row_count};
+    }
+
+    auto Reader::GetEntries() const -> std::vector<Entry>
+    {
+        std::vector<Entry> entries(GetHeader().row_count);
+        for (const auto &field : GetEntryFields())
+        {
+            const auto values = GetColumn(field.name);
+            for (size_t row = 0; row < entries.size(); ++row)
+            {
+                entries[row].*field.member = values[row];
+            }
+        }
+        return entries;
+    }
+}
@@ -0,0 +1,137 @@
+#include "DriftTelemetry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <ostream>
+#include <string_view>
+
+#include "Error.hpp"
+
+namespace FlightPath
+{
+    LogHistogram::LogHistogram(const double min, const double max, const size_t bins_per_decade)
+        : log_min_(std::log10(min)), bins_per_decade_(static_cast<double>(bins_per_decade))
+    {
+        Ensure(min > 0.0 && max > min && bins_per_decade > 0, "LogHistogram: Invalid bounds [{}, {}] or bins per decade {}", min, max, bins_per_decade);
+
+        const auto bins = static_cast<size_t>(std::ceil((std::log10(max) - log_min_) * bins_per_decade_));
+        counts_.assign(bins + 2, 0);
+    }
+
+    auto LogHistogram::Add(const double value) -> void
+    {
+        // note: NaN and values <= 0 end up in the underflow bin
+        const double position = value > 0.0 ? (std::log10(value) - log_min_) * bins_per_decade_ : -1.0;
+        size_t bin = 0;
+        if (position >= 0.0)
+        {
+            bin = std::min(static_cast<size_t>(position) + 1, counts_.size() - 1);
+        }
+        ++counts_[bin];
+        ++total_;
+    }
+
+    auto LogHistogram::GetLowerBound(const size_t bin) const -> double
+    {
+        if (bin == 0) return 0.0;
+        return std::pow(10.0, log_min_ + static_cast<double>(bin - 1) / bins_per_decade_);
+    }
+
+    auto LogHistogram::GetPercentile(const double percentile) const -> double
+    {
+        if (total_ == 0) return 0.0;
+
+        const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(total_))));
+        uint64_t seen = 0;
+        for (size_t bin = 0; bin < counts_.size(); ++bin)
+        {
+            seen += counts_[bin];
+            if (seen >= rank)
+            {
+                return GetLowerBound(std::min(bin + 1, counts_.size() - 1));
+            }
+        }
+        return GetLowerBound(counts_.size() - 1);
+    }
+
+    auto DriftStatistic::Add(const double value) -> void
+    {
+        if (histogram.GetTotal() == 0)
+        {
+            min = value;
+            max = value;
+        }
+        min = std::min(min, value);
+        max = std::max(max, value);
+        sum += value;
+        histogram.Add(value);
+    }
+
+    auto DriftStatistic::GetMean() const -> double
+    {
+        return histogram.GetTotal() > 0 ? sum / static_cast<double>(histogram.GetTotal()) : 0.0;
+    }
+
+    DriftTelemetry::DriftTelemetry(const size_t sample_interval)
+        : sample_interval_(sample_interval)
+        , orthogonal_error_{.histogram = LogHistogram(1e-18, 1e0,  2)}
+        , length_error_    {.histogram = LogHistogram(1e-18, 1e0,  2)}
+        , dt_              {.histogram = LogHistogram(1e-4,  1e1,  4)}
+        , divergence_      {.histogram = LogHistogram(1e-3,  1e5,  2)}
+    {
+        Ensure(sample_interval > 0, "DriftTelemetry: Invalid sample interval {}", sample_interval);
+    }
+
+    auto DriftTelemetry::Add(const DriftSample &sample) -> void
+    {
+        ++samples_;
+        orthogonal_error_.Add(sample.orthogonal_error);
+        length_error_.Add(sample.length_error);
+        dt_.Add(sample.dt);
+        divergence_.Add(sample.divergence);
+    }
+
+    auto DriftTelemetry::GetMeanIterations() const -> double
+    {
+        uint64_t total = 0;
+        for (size_t i = 0; i < iterations_.size(); ++i) total += i * iterations_[i];
+        return steps_ > 0 ? static_cast<double>(total) / static_cast<double>(steps_) : 0.0;
+    }
+
+    // the percentile is the upper bound of a bin, clamped to the sampled range
+    // e.g. "  orthogonal error   min 1.2e-17  mean 3.4e-16  p99 1.0e-15  max 2.2e-15"
+    //      "    [1.0e-16, 3.2e-16)  1234"
+    static auto WriteStatistic(std::ostream &output, const std::string_view name, const DriftStatistic &statistic) -> void
+    {
+        output << std::format("  {:<18} min {:.1e}  mean {:.1e}  p99 {:.1e}  max {:.1e}\n",
+            name, statistic.min, statistic.GetMean(), std::clamp(statistic.histogram.GetPercentile(99.0), statistic.min, statistic.max), statistic.max);
+
+        const auto &counts = statistic.histogram.GetCounts();
+        for (size_t bin = 0; bin < counts.size(); ++bin)
+        {
+            if (counts[bin] == 0) continue;
+
+            const std::string upper = bin + 1 < counts.size() ? std::format("{:.1e})", statistic.histogram.GetLowerBound(bin + 1)) : "inf)";
+            output << std::format("    [{:.1e}, {:<9} {:>10}\n", statistic.histogram.GetLowerBound(bin), upper, counts[bin]);
+        }
+    }
+
+    auto DriftTelemetry::WriteSummary(std::ostream &output) const -> void
+    {
+        output << std::format("{} steps, {} sampled (every {}), Orthonormalize {:.3f} iterations per step\n",
+            steps_, samples_, sample_interval_, GetMeanIterations());
+
+        output << "  iterations        ";
+        for (size_t i = 0; i < iterations_.size(); ++i)
+        {
+            if (iterations_[i] > 0) output << std::format(" {}: {}", i, iterations_[i]);
+        }
+        output << '\n';
+
+        WriteStatistic(output, "orthogonal error", orthogonal_error_);
+        WriteStatistic(output, "length error",     length_error_);
+        WriteStatistic(output, "dt [s]",           dt_);
+        WriteStatistic(output, "divergence [m]",   divergence_);
+    }
+}
@@ -0,0 +1,202 @@
+#include "KMLLod.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <limits>
+
+#include "Error.hpp"
+#include "KML.hpp"
+#include "KMLWriter.hpp"
+#include "Parallel.hpp"
+#include "Simplify.hpp"
+#include "Trace.hpp"
+#include "Units.hpp"
+
+namespace FlightPath
+{
+    // one exported track (original or reconstructed)
+    struct LodTrack
+    {
+        std::string_view    name;  ///< Display name.
+        std::string_view    file;  ///< Prefix of the tile files.
+        std::string_view    style; ///< Style id.
+        std::span<const Entry> entries;
+    };
+
+    // geographic bounding box of a tile in degrees
+    struct LodBox
+    {
+        double north = -std::numeric_limits<double>::infinity();
+        double south =  std::numeric_limits<double>::infinity();
+        double east  = -std::numeric_limits<double>::infinity();
+        double west  =  std::numeric_limits<double>::infinity();
+    };
+
+    // a tile overlaps its successor by one entry, so the tiles form a continuous line
+    static auto GetTile(const std::span<const Entry> entries, const size_t tile, const size_t tile_size) -> std::span<const Entry>
+    {
+        const size_t first = tile * tile_size;
+        const size_t last  = std::min(first + tile_size, entries.size() - 1);
+        return entries.subspan(first, last - first + 1);
+    }
+
+    static auto GetTileCount(const std::span<const Entry> entries, const size_t tile_size) -> size_t
+    {
+        return entries.size() < 2 ? 0 : (entries.size() - 2) / tile_size + 1;
+    }
+
+    static auto GetTilePath(const LodTrack &track, const size_t tile, const size_t level) -> std::string
+    {
+        return std::format("tiles/{}_{:04}_{}.kml", track.file, tile, level);
+    }
+
+    // bounding box with a margin, so that straight north-south or east-west legs do not result in an empty region
+    static auto GetBox(const std::span<const Entry> entries) -> LodBox
+    {
+        LodBox box;
+        for (const auto &entry : entries)
+        {
+            const double longitude = rad2deg<double>(entry.longitude);
+            const double latitude  = rad2deg<double>(entry.latitude);
+            box.north = std::max(box.north, latitude);
+            box.south = std::min(box.south, latitude);
+            box.east  = std::max(box.east,  longitude);
+            box.west  = std::min(box.west,  longitude);
+        }
+
+        const double margin = 0.1 * std::max(box.north - box.south, box.east - box.west) + 1e-4;
+        box.north = std::min(box.north + margin,   90.0);
+        box.south = std::max(box.south - margin,  -90.0);
+        box.east  = std::min(box.east  + margin,  180.0);
+        box.west  = std::max(box.west  - margin, -180.0);
+        return box;
+    }
+
+    // writes an ISO 8601 time stamp (UTC with milliseconds) without allocating
+    static auto WriteTimestamp(KMLWriter &writer, const std::chrono::sys_seconds start_time, const double time) -> void
+    {
+        using namespace std::chrono;
+
+        const auto point = start_time + milliseconds(static_cast<long long>(std::llround(time * 1000.0)));
+        const auto day   = floor<days>(point);
+        const year_month_day date{day};
+        const hh_mm_ss clock{point - day};
+
+        char text[64];
+        const auto result = std::format_to_n(text, sizeof(text), "{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:03}Z",
+            static_cast<int>(date.year()), static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()),
+            clock.hours().count(), clock.minutes().count(), clock.seconds().count(), clock.subseconds().count());
+        writer.Write(std::string_view(text, static_cast<size_t>(result.out - text)));
+    }
+
+    static auto WriteTile(const std::filesystem::path &path, const LodTrack &track, const std::span<const Entry> tile, const size_t tile_index, const double tolerance, const std::chrono::sys_seconds start_time) -> void
+    {
+        const auto kept = SimplifyTrack(tile, tolerance);
+
+        KMLWriter writer(path.string());
+        writer.Write(KML::TrackHeader);
+        writer.Write(KML::Styles);
+        writer.Write(std::format("<Placemark>\n    <name>{} {}</name>\n    <styleUrl>#{}</styleUrl>\n    <gx:Track>\n        <altitudeMode>absolute</altitudeMode>\n", track.name, tile_index, track.style));
+
+        for (const size_t index : kept)
+        {
+            writer.Write("        <when>");
+            WriteTimestamp(writer, start_time, tile[index].time);
+            writer.Write("</when>\n");
+        }
+
+        for (const size_t index : kept)
+        {
+            writer.Write("        <gx:coord>");
+            writer.WriteFixed(rad2deg<double>(tile[index].longitude), 0, 9);
+            writer.Write(" ");
+            writer.WriteFixed(rad2deg<double>(tile[index].latitude), 0, 9);
+            writer.Write(" ");
+            writer.WriteFixed(tile[index].altitude, 0, 1);
+            writer.Write("</gx:coord>\n");
+        }
+
+        writer.Write("    </gx:Track>\n</Placemark>\n");
+        writer.Write(KML::Footer);
+        writer.Flush();
+    }
+
+    static auto WriteNetworkLinks(KMLWriter &writer, const LodTrack &track, const LodSettings &settings) -> void
+    {
+        writer.Write(std::format("<Folder>\n    <name>{}</name>\n", track.name));
+
+        const size_t tile_count = GetTileCount(track.entries, settings.tile_size);
+        for (size_t tile = 0; tile < tile_count; ++tile)
+        {
+            const LodBox box = GetBox(GetTile(track.entries, tile, settings.tile_size));
+            for (size_t level = 0; level < settings.levels.size(); ++level)
+            {
+                writer.Write(std::format(
+                    "    <NetworkLink>\n"
+                    "        <name>{} {} (level {})</name>\n"
+                    "        <Region>\n"
+                    "            <LatLonAltBox><north>{:.9f}</north><south>{:.9f}</south><east>{:.9f}</east><west>{:.9f}</west></LatLonAltBox>\n"
+                    "            <Lod><minLodPixels>{}</minLodPixels><maxLodPixels>{}</maxLodPixels></Lod>\n"
+                    "        </Region>\n"
+                    "        <Link><href>{}</href><viewRefreshMode>onRegion</viewRefreshMode></Link>\n"
+                    "    </NetworkLink>\n",
+                    track.name, tile, level,
+                    box.north, box.south, box.east, box.west,
+                    settings.levels[level].min_lod_pixels, settings.levels[level].max_lod_pixels,
+                    GetTilePath(track, tile, level)));
+            }
+        }
+
+        writer.Write("</Folder>\n");
+    }
+
+    auto ExportLodKML(const std::string &directory, const std::span<const Entry> original, const std::span<const Entry> reconstructed, const LodSettings &settings) -> void
+    {
+        Ensure(settings.tile_size > 0, "ExportLodKML: Invalid tile size {}", settings.tile_size);
+        Ensure(!settings.levels.empty(), "ExportLodKML: No levels of detail");
+
+        const std::filesystem::path root(directory);
+        std::filesystem::create_directories(root / "tiles");
+
+        const LodTrack tracks[] = {
+            {.name = "Original Flight Path",      .file = "original",      .style = "cyanLineGreenPoly",   .entries = original},
+            {.name = "Reconstructed Flight Path", .file = "reconstructed", .style = "purpleLineGreenPoly", .entries = reconstructed},
+        };
+
+        // all (track, tile, level) combinations are independent files
+        struct Job { const LodTrack *track; size_t tile; size_t level; };
+        std::vector<Job> jobs;
+        for (const auto &track : tracks)
+        {
+            const size_t tile_count = GetTileCount(track.entries, settings.tile_size);
+            for (size_t tile = 0; tile < tile_count; ++tile)
+            {
+                for (size_t level = 0; level < settings.levels.size(); ++level)
+                {
+                    jobs.push_back(Job{.track = &track, .tile = tile, .level = level});
+                }
+            }
+        }
+
+        const auto run_job = [&](const Job &job)
+        {
+            Trace::Span span("LOD tile");
+            WriteTile(root / GetTilePath(*job.track, job.tile, job.level), *job.track,
+                GetTile(job.track->entries, job.tile, settings.tile_size), job.tile,
+                settings.levels[job.level].tolerance, settings.start_time);
+        };
+
+        ParallelFor(jobs.size(), [&](const size_t j) { run_job(jobs[j]); });
+
+        KMLWriter writer((root / "doc.kml").string());
+        writer.Write(KML::TrackHeader);
+        for (const auto &track : tracks)
+        {
+            WriteNetworkLinks(writer, track, settings);
+        }
+        writer.Write(KML::Footer);
+        writer.Flush();
+    }
+}
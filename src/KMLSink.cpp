@@ -0,0 +1,79 @@
+#include "KMLSink.hpp"
+
+#include "KML.hpp"
+#include "ReferenceFrame.hpp"
+#include "Units.hpp"
+
+namespace FlightPath
+{
+    // writes one line of a <coordinates> element
+    static auto WriteCoordinate(KMLWriter &writer, const Entry &entry) -> void
+    {
+        writer.WriteCoordinate(
+            rad2deg<double>(entry.longitude),
+            rad2deg<double>(entry.latitude),
+            entry.altitude);
+    }
+
+    KMLSink::KMLSink(const std::string &path, const double tolerance)
+        : writer_(path), tolerance_(tolerance), simplifier_(tolerance)
+    {
+        writer_.Write(KML::Header);
+    }
+
+    auto KMLSink::WriteTrack(const std::string_view open, const std::span<const Entry> entries) -> void
+    {
+        writer_.Write(open);
+        for (const size_t index : SimplifyTrack(entries, tolerance_))
+        {
+            WriteCoordinate(writer_, entries[index]);
+        }
+        writer_.Write(KML::CloseDataset);
+    }
+
+    auto KMLSink::BeginTrack(const std::string_view open) -> void
+    {
+        writer_.Write(open);
+        simplifier_.Reset();
+        count_ = 0;
+    }
+
+    auto KMLSink::Push(const Entry &entry) -> void
+    {
+        const bool keep_previous = simplifier_.Push(ReferenceFrame::GetEarthCoordinates(
+            Position{
+                .longitude = entry.longitude,
+                .latitude  = entry.latitude,
+                .altitude  = entry.altitude}
+        ));
+
+        // the first entry is always a vertex, all others once the simplifier tells so
+        if (count_ == 0)
+        {
+            WriteCoordinate(writer_, entry);
+        }
+        else if (keep_previous)
+        {
+            WriteCoordinate(writer_, previous_);
+        }
+
+        previous_ = entry;
+        ++count_;
+    }
+
+    auto KMLSink::EndTrack() -> void
+    {
+        // the last entry is always a vertex (unless it is the first one, which is already written)
+        if (count_ > 1)
+        {
+            WriteCoordinate(writer_, previous_);
+        }
+        writer_.Write(KML::CloseDataset);
+    }
+
+    auto KMLSink::Close() -> void
+    {
+        writer_.Write(KML::Footer);
+        writer_.Flush();
+    }
+}
@@ -0,0 +1,102 @@
+#include "KMLWriter.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+#include "Error.hpp"
+
+namespace FlightPath
+{
+    // longest fixed notation of a double with up to 9 decimals (sign, 309 integer digits, point, decimals)
+    static constexpr size_t MaxFieldLength = 1 + 309 + 1 + 9;
+
+    // upper bound of one formatted coordinate line (indentation, three fields, separators)
+    static constexpr size_t MaxCoordinateLength = 12 + 3*MaxFieldLength + 5;
+
+    // formats value like std::format("{:<width>.<precision>f}") into first, returns the end of the output
+    static auto FormatFixed(char *first, const double value, const size_t width, const int precision) -> char*
+    {
+        const auto [end, ec] = std::to_chars(first, first + MaxFieldLength, value, std::chars_format::fixed, precision);
+        Ensure(ec == std::errc(), "KMLWriter: Could not format value {}", value);
+
+        // right-align the number within the field width
+        const auto length  = static_cast<size_t>(end - first);
+        const auto padding = width > length ? width - length : 0;
+        if (padding > 0)
+        {
+            std::memmove(first + padding, first, length);
+            std::memset(first, ' ', padding);
+        }
+        return end + padding;
+    }
+
+    KMLWriter::KMLWriter(const std::string &path, const size_t buffer_size)
+        : path_(path), file_(path), buffer_(std::max(buffer_size, 2*MaxCoordinateLength), TrackingAllocator<char>(GetTransientMemory()))
+    {
+        Ensure(file_.is_open(), "KMLWriter: Could not open file {}", path);
+    }
+
+    KMLWriter::~KMLWriter()
+    {
+        // no exceptions from the destructor, errors are reported by an explicit Flush()
+        file_.write(buffer_.data(), static_cast<std::streamsize>(size_));
+    }
+
+    auto KMLWriter::Write(const std::string_view text) -> void
+    {
+        if (size_ + text.size() > buffer_.size())
+        {
+            Flush();
+        }
+
+        if (text.size() > buffer_.size())
+        {
+            file_.write(text.data(), static_cast<std::streamsize>(text.size()));
+            return;
+        }
+
+        std::memcpy(buffer_.data() + size_, text.data(), text.size());
+        size_ += text.size();
+    }
+
+    auto KMLWriter::WriteCoordinate(const double longitude, const double latitude, const double altitude) -> void
+    {
+        if (size_ + MaxCoordinateLength > buffer_.size())
+        {
+            Flush();
+        }
+
+        char *out = buffer_.data() + size_;
+
+        out = std::fill_n(out, 12, ' ');
+        out = FormatFixed(out, longitude, 12, 9);
+        *out++ = ','; *out++ = ' ';
+        out = FormatFixed(out, latitude, 12, 9);
+        *out++ = ','; *out++ = ' ';
+        out = FormatFixed(out, altitude, 6, 1);
+        *out++ = '\n';
+
+        size_ = static_cast<size_t>(out - buffer_.data());
+    }
+
+    auto KMLWriter::WriteFixed(const double value, const size_t width, const int precision) -> void
+    {
+        Ensure(width <= MaxFieldLength, "KMLWriter: Field width {} exceeds {}", width, MaxFieldLength);
+
+        if (size_ + MaxFieldLength > buffer_.size())
+        {
+            Flush();
+        }
+
+        char *out = FormatFixed(buffer_.data() + size_, value, width, precision);
+        size_ = static_cast<size_t>(out - buffer_.data());
+    }
+
+    auto KMLWriter::Flush() -> void
+    {
+        file_.write(buffer_.data(), static_cast<std::streamsize>(size_));
+        size_ = 0;
+        Ensure(file_.good(), "KMLWriter: Could not write file {}", path_);
+    }
+}
@@ -0,0 +1,177 @@
+#include "Log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#include "MPSCQueue.hpp"
+
+namespace FlightPath::Log
+{
+    // one queued message, the file name points to the static storage of std::source_location
+    struct Record
+    {
+        const char   *file   = nullptr;
+        uint_least32_t line  = 0;
+        Level         level  = Level::INFO;
+        uint32_t      length = 0;
+        char          text[MaxAsyncMessageLength];
+    };
+
+    // background thread draining the queue into std::cout
+    class AsyncBackend
+    {
+    public:
+        AsyncBackend()
+            : worker_([this] { Work(); })
+        {
+        }
+
+        // drains all pending records before the thread ends
+        ~AsyncBackend()
+        {
+            stop_.store(true, std::memory_order_release);
+            signal_.fetch_add(1, std::memory_order_release);
+            signal_.notify_one();
+            worker_.join();
+            std::cout.flush();
+        }
+
+        auto Push(const Level level, std::string_view message, const std::source_location &location) -> void
+        {
+            const auto fill = [&](Record &record)
+            {
+                const size_t length = std::min(message.size(), MaxAsyncMessageLength);
+                record.file   = location.file_name();
+                record.line   = location.line();
+                record.level  = level;
+                record.length = static_cast<uint32_t>(length);
+                std::memcpy(record.text, message.data(), length);
+                if (length < message.size())
+                {
+                    std::memcpy(record.text + length - 3, "...", 3);
+                }
+            };
+
+            // a full queue blocks the caller instead of losing messages
+            while (!queue_.TryPush(fill))
+            {
+                std::this_thread::yield();
+            }
+
+            pushed_.fetch_add(1, std::memory_order_release);
+            signal_.fetch_add(1, std::memory_order_release);
+            signal_.notify_one();
+        }
+
+        auto Flush() -> void
+        {
+            const uint64_t target = pushed_.load(std::memory_order_acquire);
+            for (uint64_t written = written_.load(std::memory_order_acquire); written < target; written = written_.load(std::memory_order_acquire))
+            {
+                written_.wait(written, std::memory_order_acquire);
+            }
+            std::cout.flush();
+        }
+
+    private:
+        auto Work() -> void
+        {
+            std::string buffer;
+            uint64_t written = 0;
+            for (;;)
+            {
+                const uint64_t signal = signal_.load(std::memory_order_acquire);
+                const bool stop = stop_.load(std::memory_order_acquire);
+
+                // format a batch into one buffer and write it with a single call
+                while (queue_.TryPop([&buffer](const Record &record) { Format(buffer, record); }))
+                {
+                    ++written;
+                }
+                if (!buffer.empty())
+                {
+                    std::cout << buffer;
+                    buffer.clear();
+                    written_.store(written, std::memory_order_release);
+                    written_.notify_all();
+                }
+
+                if (stop) return;
+                signal_.wait(signal, std::memory_order_acquire);
+            }
+        }
+
+        static auto Format(std::string &buffer, const Record &record) -> void
+        {
+            const std::string_view message(record.text, record.length);
+            switch (record.level)
+            {
+                case Level::DEBUG: buffer += Detail::FormatMessage<Level::DEBUG>(message, record.file, record.line); break;
+                case Level::INFO:  buffer += Detail::FormatMessage<Level::INFO >(message, record.file, record.line); break;
+                case Level::WARN:  buffer += Detail::FormatMessage<Level::WARN >(message, record.file, record.line); break;
+                case Level::ERROR: buffer += Detail::FormatMessage<Level::ERROR>(message, record.file, record.line); break;
+            }
+        }
+
+    private:
+        MPSCQueue<Record, 1024> queue_;     ///< Records from all threads.
+        std::atomic<uint64_t> pushed_{0};   ///< Number of pushed records.
+        std::atomic<uint64_t> written_{0};  ///< Number of records written to std::cout.
+        std::atomic<uint64_t> signal_{0};   ///< Changes on every push and on stop, the worker waits on it.
+        std::atomic<bool>     stop_{false}; ///< Set to end the worker.
+        std::thread           worker_;      ///< Started last, after all other members.
+    };
+
+    static std::atomic<bool> async_enabled{false};
+
+    // the static destructor disables the backend and drains the queue at the end of the program
+    static struct AsyncState
+    {
+        std::unique_ptr<AsyncBackend> backend;
+        ~AsyncState() { async_enabled.store(false, std::memory_order_release); }
+    } state;
+
+    auto EnableAsync(const bool enable) -> void
+    {
+        if (enable == async_enabled.load()) return;
+
+        if (enable)
+        {
+            state.backend = std::make_unique<AsyncBackend>();
+            async_enabled.store(true, std::memory_order_release);
+        }
+        else
+        {
+            async_enabled.store(false, std::memory_order_release);
+            state.backend.reset();
+        }
+    }
+
+    auto IsAsync() -> bool
+    {
+        return async_enabled.load(std::memory_order_acquire);
+    }
+
+    auto Flush() -> void
+    {
+        if (IsAsync())
+        {
+            state.backend->Flush();
+        }
+        else
+        {
+            std::cout.flush();
+        }
+    }
+
+    namespace Detail
+    {
+        auto Enqueue(const Level level, std::string_view message, const std::source_location &location) -> void
+        {
+            state.backend->Push(level, message, location);
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <string_view>
+
+#include "BinaryLog.hpp"
+#include "Error.hpp"
+
+// renders a binary diagnostics log (see BinaryLog) as text or CSV on standard output
+auto main(int argc, char *argv[]) -> int
+{
+    const bool csv = argc == 3 && std::string_view(argv[2]) == "--csv";
+    if (argc < 2 || (argc == 3 && !csv) || argc > 3)
+    {
+        std::cerr << std::format("usage: {} <log file> [--csv]", argc > 0 ? argv[0] : "FlightPathLogDecoder") << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        FlightPath::BinaryLog::Decode(argv[1], std::cout, csv ? FlightPath::BinaryLog::Output::CSV : FlightPath::BinaryLog::Output::Text);
+    }
+    catch (const FlightPath::Exception &err)
+    {
+        std::cerr << std::format("{}", err) << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -20,6 +20,9 @@ auto main() -> int
 {
     std::filesystem::current_path(PROJECT_ROOT_PATH);
 
+    // progress messages are written by a background thread, pending ones are written at exit
+    FlightPath::Log::EnableAsync();
+
     try
     {
         FlightPath::Application app;
@@ -27,10 +30,12 @@ auto main() -> int
     }
     catch (const FlightPath::Exception &err)
     {
+        FlightPath::Log::Flush();
         std::cerr << std::format("{}", err) << std::endl;
     }
     catch (...)
     {
+        FlightPath::Log::Flush();
         std::cerr << "unkown exception" << std::endl;
     }
     return EXIT_SUCCESS;
@@ -0,0 +1,175 @@
+#include "MappedFile.hpp"
+
+#include <utility>
+
+#include "Error.hpp"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <cstring>
+    #include <format>
+
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace FlightPath
+{
+#ifdef _WIN32
+    static void *const NoFile = nullptr;
+#else
+    static constexpr int NoFile = -1;
+#endif
+
+#ifdef _WIN32
+    MappedFile::MappedFile(const std::string &path, const size_t size)
+        : size_(size), writable_(true)
+    {
+        file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) file_ = nullptr;
+        Ensure(file_ != nullptr, "MappedFile: Could not create file {}", path);
+
+        // the mapping extends the file to its size, the new bytes are zero
+        const auto high = static_cast<DWORD>(static_cast<unsigned long long>(size) >> 32);
+        const auto low  = static_cast<DWORD>(size & 0xFFFFFFFFu);
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE, high, low, nullptr);
+        if (mapping_ == nullptr) Close();
+        Ensure(mapping_ != nullptr, "MappedFile: Could not map file {}", path);
+
+        data_ = static_cast<std::byte*>(MapViewOfFile(mapping_, FILE_MAP_WRITE, 0, 0, size));
+        if (data_ == nullptr) Close();
+        Ensure(data_ != nullptr, "MappedFile: Could not map file {}", path);
+    }
+
+    MappedFile::MappedFile(const std::string &path)
+    {
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) file_ = nullptr;
+        Ensure(file_ != nullptr, "MappedFile: Could not open file {}", path);
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) Close();
+        Ensure(file_ != nullptr, "MappedFile: Could not map empty file {}", path);
+        size_ = static_cast<size_t>(size.QuadPart);
+
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr) Close();
+        Ensure(mapping_ != nullptr, "MappedFile: Could not map file {}", path);
+
+        data_ = static_cast<std::byte*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_ == nullptr) Close();
+        Ensure(data_ != nullptr, "MappedFile: Could not map file {}", path);
+    }
+
+    auto MappedFile::Sync() const -> void
+    {
+        if (data_ == nullptr || !writable_) return;
+        Ensure(FlushViewOfFile(data_, size_) && FlushFileBuffers(file_), "MappedFile: Could not sync mapping");
+    }
+
+    auto MappedFile::Close() noexcept -> void
+    {
+        if (data_    != nullptr) UnmapViewOfFile(data_);
+        if (mapping_ != nullptr) CloseHandle(mapping_);
+        if (file_    != nullptr) CloseHandle(file_);
+        data_    = nullptr;
+        mapping_ = nullptr;
+        file_    = nullptr;
+        size_    = 0;
+    }
+#else
+    MappedFile::MappedFile(const std::string &path, const size_t size)
+        : size_(size), writable_(true)
+    {
+        file_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        Ensure(file_ >= 0, "MappedFile: Could not create file {}", path);
+
+        // a truncated file is extended with zeros (sparse where the file system supports it)
+        if (::ftruncate(file_, static_cast<off_t>(size)) != 0) Close();
+        Ensure(file_ >= 0, "MappedFile: Could not resize file {} to {} bytes", path, size);
+
+        void *data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file_, 0);
+        if (data == MAP_FAILED)
+        {
+            // close may overwrite errno
+            const int error = errno;
+            Close();
+            throw Exception(std::format("MappedFile: Could not map file {}: {}", path, std::strerror(error)));
+        }
+        data_ = static_cast<std::byte*>(data);
+    }
+
+    MappedFile::MappedFile(const std::string &path)
+    {
+        file_ = ::open(path.c_str(), O_RDONLY);
+        Ensure(file_ >= 0, "MappedFile: Could not open file {}", path);
+
+        struct stat status{};
+        if (::fstat(file_, &status) != 0 || status.st_size == 0) Close();
+        Ensure(file_ >= 0, "MappedFile: Could not map empty file {}", path);
+        size_ = static_cast<size_t>(status.st_size);
+
+        void *data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, file_, 0);
+        if (data == MAP_FAILED)
+        {
+            const int error = errno;
+            Close();
+            throw Exception(std::format("MappedFile: Could not map file {}: {}", path, std::strerror(error)));
+        }
+        data_ = static_cast<std::byte*>(data);
+    }
+
+    auto MappedFile::Sync() const -> void
+    {
+        if (data_ == nullptr || !writable_) return;
+        Ensure(::msync(data_, size_, MS_SYNC) == 0, "MappedFile: Could not sync mapping");
+    }
+
+    auto MappedFile::Close() noexcept -> void
+    {
+        if (data_ != nullptr) ::munmap(data_, size_);
+        if (file_ >= 0) ::close(file_);
+        data_ = nullptr;
+        file_ = -1;
+        size_ = 0;
+    }
+#endif
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : data_(std::exchange(other.data_, nullptr))
+        , size_(std::exchange(other.size_, 0))
+        , writable_(other.writable_)
+        , file_(std::exchange(other.file_, NoFile))
+#ifdef _WIN32
+        , mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+    {
+    }
+
+    auto MappedFile::operator=(MappedFile &&other) noexcept -> MappedFile&
+    {
+        if (this != &other)
+        {
+            Close();
+            data_     = std::exchange(other.data_, nullptr);
+            size_     = std::exchange(other.size_, 0);
+            writable_ = other.writable_;
+            file_     = std::exchange(other.file_, NoFile);
+#ifdef _WIN32
+            mapping_  = std::exchange(other.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+}
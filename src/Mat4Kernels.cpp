@@ -0,0 +1,248 @@
+#include "Mat4Kernels.hpp"
+
+#include <algorithm>
+
+#include "Error.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define FLIGHTPATH_X86_64 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        // msvc allows intrinsics of any instruction set without additional flags
+        #define FLIGHTPATH_TARGET(isa)
+    #else
+        // compile single functions for a specific instruction set without raising the baseline of the whole library
+        #define FLIGHTPATH_TARGET(isa) __attribute__((target(isa)))
+    #endif
+#else
+    #define FLIGHTPATH_X86_64 0
+#endif
+
+namespace FlightPath::Kernels
+{
+#if FLIGHTPATH_X86_64
+    namespace
+    {
+        /* Double precision kernels (row-major, C_i = sum_k A_ik * B_k) */
+
+        FLIGHTPATH_TARGET("avx2,fma")
+        auto Multiply4x4AVX2(const double *A, const double *B, double *C) -> void
+        {
+            // one 256-bit register holds one row of B
+            const __m256d b0 = _mm256_loadu_pd(B +  0);
+            const __m256d b1 = _mm256_loadu_pd(B +  4);
+            const __m256d b2 = _mm256_loadu_pd(B +  8);
+            const __m256d b3 = _mm256_loadu_pd(B + 12);
+
+            for (int i = 0; i < 4; ++i)
+            {
+                const double *Ai = A + i*4;
+                __m256d c = _mm256_mul_pd(_mm256_broadcast_sd(Ai + 0), b0);
+                c = _mm256_fmadd_pd(_mm256_broadcast_sd(Ai + 1), b1, c);
+                c = _mm256_fmadd_pd(_mm256_broadcast_sd(Ai + 2), b2, c);
+                c = _mm256_fmadd_pd(_mm256_broadcast_sd(Ai + 3), b3, c);
+                _mm256_storeu_pd(C + i*4, c);
+            }
+        }
+
+        FLIGHTPATH_TARGET("avx512f")
+        auto Multiply4x4AVX512(const double *A, const double *B, double *C) -> void
+        {
+            // one 512-bit register holds the same row of B twice
+            const __m512d b0 = _mm512_broadcast_f64x4(_mm256_loadu_pd(B +  0));
+            const __m512d b1 = _mm512_broadcast_f64x4(_mm256_loadu_pd(B +  4));
+            const __m512d b2 = _mm512_broadcast_f64x4(_mm256_loadu_pd(B +  8));
+            const __m512d b3 = _mm512_broadcast_f64x4(_mm256_loadu_pd(B + 12));
+
+            // two rows of A and C per iteration, permutex broadcasts within each 256-bit half
+            for (int i = 0; i < 4; i += 2)
+            {
+                const __m512d a = _mm512_loadu_pd(A + i*4);
+                __m512d c = _mm512_mul_pd(_mm512_permutex_pd(a, 0x00), b0);
+                c = _mm512_fmadd_pd(_mm512_permutex_pd(a, 0x55), b1, c);
+                c = _mm512_fmadd_pd(_mm512_permutex_pd(a, 0xAA), b2, c);
+                c = _mm512_fmadd_pd(_mm512_permutex_pd(a, 0xFF), b3, c);
+                _mm512_storeu_pd(C + i*4, c);
+            }
+        }
+
+        /* Single precision kernels */
+
+        FLIGHTPATH_TARGET("avx2,fma")
+        auto Multiply4x4AVX2(const float *A, const float *B, float *C) -> void
+        {
+            // one 256-bit register holds the same row of B twice
+            const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B +  0));
+            const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B +  4));
+            const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B +  8));
+            const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B + 12));
+
+            // two rows of A and C per iteration, permute broadcasts within each 128-bit lane
+            for (int i = 0; i < 4; i += 2)
+            {
+                const __m256 a = _mm256_loadu_ps(A + i*4);
+                __m256 c = _mm256_mul_ps(_mm256_permute_ps(a, 0x00), b0);
+                c = _mm256_fmadd_ps(_mm256_permute_ps(a, 0x55), b1, c);
+                c = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xAA), b2, c);
+                c = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xFF), b3, c);
+                _mm256_storeu_ps(C + i*4, c);
+            }
+        }
+
+        FLIGHTPATH_TARGET("avx512f")
+        auto Multiply4x4AVX512(const float *A, const float *B, float *C) -> void
+        {
+            // one 512-bit register holds the same row of B four times
+            const __m512 b0 = _mm512_broadcast_f32x4(_mm_loadu_ps(B +  0));
+            const __m512 b1 = _mm512_broadcast_f32x4(_mm_loadu_ps(B +  4));
+            const __m512 b2 = _mm512_broadcast_f32x4(_mm_loadu_ps(B +  8));
+            const __m512 b3 = _mm512_broadcast_f32x4(_mm_loadu_ps(B + 12));
+
+            // the whole matrix A fits into one register, permute broadcasts within each 128-bit lane
+            const __m512 a = _mm512_loadu_ps(A);
+            __m512 c = _mm512_mul_ps(_mm512_permute_ps(a, 0x00), b0);
+            c = _mm512_fmadd_ps(_mm512_permute_ps(a, 0x55), b1, c);
+            c = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xAA), b2, c);
+            c = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xFF), b3, c);
+            _mm512_storeu_ps(C, c);
+        }
+    }
+#endif
+
+    auto DetectSimdLevel() -> SimdLevel
+    {
+#if FLIGHTPATH_X86_64
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        const int max_leaf = info[0];
+
+        __cpuid(info, 1);
+        const bool has_osxsave = (info[2] & (1 << 27)) != 0;
+        const bool has_avx     = (info[2] & (1 << 28)) != 0;
+        const bool has_fma     = (info[2] & (1 << 12)) != 0;
+        if (!has_osxsave || !has_avx || max_leaf < 7)
+        {
+            return SimdLevel::Scalar;
+        }
+
+        // check that the os saves the ymm (and zmm) registers on context switches
+        const unsigned long long xcr0 = _xgetbv(0);
+        const bool os_avx    = (xcr0 & 0x06) == 0x06;
+        const bool os_avx512 = (xcr0 & 0xE6) == 0xE6;
+
+        __cpuidex(info, 7, 0);
+        const bool has_avx2    = (info[1] & (1 <<  5)) != 0;
+        const bool has_avx512f = (info[1] & (1 << 16)) != 0;
+
+        if (os_avx512 && has_avx512f)         return SimdLevel::AVX512;
+        if (os_avx && has_avx2 && has_fma)    return SimdLevel::AVX2;
+    #else
+        // the builtins also verify that the os supports the extended register state
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))                                    return SimdLevel::AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))      return SimdLevel::AVX2;
+    #endif
+#endif
+        return SimdLevel::Scalar;
+    }
+
+    auto GetSimdLevel() -> SimdLevel
+    {
+        // Products in this code base mostly form dependent chains (frame_ = frame_ * other). There the
+        // in-register permutes of the AVX-512 kernels cost more latency than the wider registers save
+        // (double: ~12 ns AVX2 vs. ~24 ns AVX-512 per chained product), so AVX2 is preferred.
+        static const SimdLevel level = std::min(DetectSimdLevel(), SimdLevel::AVX2);
+        return level;
+    }
+
+    auto IsSupported(const SimdLevel level) -> bool
+    {
+        static const SimdLevel detected_level = DetectSimdLevel();
+        return level <= detected_level;
+    }
+
+    auto ToString(const SimdLevel level) -> std::string_view
+    {
+        switch (level)
+        {
+            case SimdLevel::Scalar: return "Scalar";
+            case SimdLevel::AVX2:   return "AVX2";
+            case SimdLevel::AVX512: return "AVX512";
+        }
+        return "Unknown";
+    }
+
+    namespace
+    {
+        // returns the kernel of the requested level or throws if it cannot run on this machine
+        template <typename REAL>
+        auto SelectKernel(const SimdLevel level) -> Kernel4x4<REAL>
+        {
+            Ensure(IsSupported(level), "Kernels: {} is not supported on this machine", ToString(level));
+
+            switch (level)
+            {
+#if FLIGHTPATH_X86_64
+                case SimdLevel::AVX512: return Multiply4x4AVX512;
+                case SimdLevel::AVX2:   return Multiply4x4AVX2;
+#endif
+                default:                return Multiply4x4Scalar<REAL>;
+            }
+        }
+
+        // the dispatched kernel, nullptr for the scalar level so that callers can inline it
+        template <typename REAL>
+        auto SelectVectorKernel() -> Kernel4x4<REAL>
+        {
+            const SimdLevel level = GetSimdLevel();
+            return level == SimdLevel::Scalar ? nullptr : SelectKernel<REAL>(level);
+        }
+
+        template <typename REAL>
+        auto MultiplyDispatched(const REAL *A, const REAL *B, REAL *C) -> void
+        {
+            if (const Kernel4x4<REAL> kernel = GetMultiply4x4Kernel<REAL>())
+            {
+                kernel(A, B, C);
+            }
+            else
+            {
+                Multiply4x4Scalar(A, B, C);
+            }
+        }
+    }
+
+    template <>
+    auto SelectMultiply4x4Kernel<double>() -> Kernel4x4<double>
+    {
+        return SelectVectorKernel<double>();
+    }
+
+    template <>
+    auto SelectMultiply4x4Kernel<float>() -> Kernel4x4<float>
+    {
+        return SelectVectorKernel<float>();
+    }
+
+    auto Multiply4x4(const double *A, const double *B, double *C) -> void
+    {
+        MultiplyDispatched(A, B, C);
+    }
+
+    auto Multiply4x4(const float *A, const float *B, float *C) -> void
+    {
+        MultiplyDispatched(A, B, C);
+    }
+
+    auto Multiply4x4(const double *A, const double *B, double *C, const SimdLevel level) -> void
+    {
+        SelectKernel<double>(level)(A, B, C);
+    }
+
+    auto Multiply4x4(const float *A, const float *B, float *C, const SimdLevel level) -> void
+    {
+        SelectKernel<float>(level)(A, B, C);
+    }
+}
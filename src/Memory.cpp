@@ -0,0 +1,77 @@
+#include "Memory.hpp"
+
+#include <fstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/resource.h>
+#endif
+
+namespace FlightPath
+{
+    auto MemoryAccount::Allocate(const size_t bytes) noexcept -> void
+    {
+        const size_t current = current_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t peak = peak_.load(std::memory_order_relaxed);
+        while (current > peak && !peak_.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    auto MemoryAccount::Deallocate(const size_t bytes) noexcept -> void
+    {
+        current_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    auto GetTransientMemory() -> MemoryAccount&
+    {
+        static MemoryAccount account;
+        return account;
+    }
+
+    auto GetResidentMemory() -> ResidentMemory
+    {
+        ResidentMemory memory;
+#if defined(__linux__)
+        // e.g. "VmHWM:     1234 kB"
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (line.starts_with("VmHWM:")) memory.peak    = std::stoull(line.substr(6)) * 1024;
+            if (line.starts_with("VmRSS:")) memory.current = std::stoull(line.substr(6)) * 1024;
+        }
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+        if (memory.peak == 0)
+        {
+            rusage usage{};
+            getrusage(RUSAGE_SELF, &usage);
+    #if defined(__APPLE__)
+            memory.peak = static_cast<size_t>(usage.ru_maxrss);
+    #else
+            memory.peak = static_cast<size_t>(usage.ru_maxrss) * 1024;
+    #endif
+        }
+#endif
+        return memory;
+    }
+
+    auto ResetPeakResidentMemory() -> bool
+    {
+#if defined(__linux__)
+        std::ofstream clear_refs("/proc/self/clear_refs");
+        clear_refs << "5";
+        clear_refs.close();
+        return !clear_refs.fail();
+#else
+        return false;
+#endif
+    }
+
+    auto MemoryPhase::GetBytesPerSample() const -> double
+    {
+        if (samples == 0) return 0.0;
+        return static_cast<double>(input_bytes + output_bytes + transient_bytes) / static_cast<double>(samples);
+    }
+}
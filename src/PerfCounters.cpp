@@ -0,0 +1,171 @@
+#include "PerfCounters.hpp"
+
+#include <algorithm>
+#include <format>
+
+#if defined(__linux__)
+    #include <cerrno>
+    #include <cstring>
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace FlightPath
+{
+    auto GetName(const PerfEvent event) -> std::string_view
+    {
+        switch (event)
+        {
+            case PerfEvent::Cycles:       return "cycles";
+            case PerfEvent::Instructions: return "instructions";
+            case PerfEvent::L1DMisses:    return "L1d misses";
+            case PerfEvent::LLCMisses:    return "LLC misses";
+            case PerfEvent::BranchMisses: return "branch misses";
+        }
+        return "unknown";
+    }
+
+    auto PerfSample::Get(const PerfEvent event) const -> std::optional<uint64_t>
+    {
+        const auto index = static_cast<size_t>(event);
+        if (!valid[index]) return std::nullopt;
+        return counts[index];
+    }
+
+    auto PerfSample::GetIPC() const -> std::optional<double>
+    {
+        const auto cycles       = Get(PerfEvent::Cycles);
+        const auto instructions = Get(PerfEvent::Instructions);
+        if (!cycles || !instructions || *cycles == 0) return std::nullopt;
+        return static_cast<double>(*instructions) / static_cast<double>(*cycles);
+    }
+
+    auto PerfSample::GetPer(const PerfEvent event, const size_t items) const -> std::optional<double>
+    {
+        const auto count = Get(event);
+        if (!count || items == 0) return std::nullopt;
+        return static_cast<double>(*count) / static_cast<double>(items);
+    }
+
+#if defined(__linux__)
+    // type and config of every PerfEvent for perf_event_attr
+    static auto GetEventConfig(const PerfEvent event) -> std::pair<uint32_t, uint64_t>
+    {
+        constexpr uint64_t read_miss = PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+        switch (event)
+        {
+            case PerfEvent::Cycles:       return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+            case PerfEvent::Instructions: return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS};
+            case PerfEvent::L1DMisses:    return {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | read_miss};
+            case PerfEvent::LLCMisses:    return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES};
+            case PerfEvent::BranchMisses: return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES};
+        }
+        return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+    }
+
+    PerfCounters::PerfCounters()
+    {
+        files_.fill(-1);
+        for (size_t i = 0; i < PerfEventCount; ++i)
+        {
+            const auto [type, config] = GetEventConfig(static_cast<PerfEvent>(i));
+
+            perf_event_attr attr{};
+            attr.size           = sizeof(attr);
+            attr.type           = type;
+            attr.config         = config;
+            attr.disabled       = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            // threads started later (e.g. by ParallelFor) get child counters, which follow the ioctls of
+            // this one and add up in read, so the parallel phases are counted completely
+            // note: a reset does not clear the counts of exited threads, hence Stop subtracts the values of Start
+            // note: inherit rules out PERF_FORMAT_GROUP, which is why every event is read on its own
+            attr.inherit        = 1;
+
+            // calling thread and its future threads, any cpu, no group
+            files_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (files_[i] < 0)
+            {
+                error_ = std::format("perf_event_open failed for {}: {}", GetName(static_cast<PerfEvent>(i)), std::strerror(errno));
+            }
+        }
+        if (IsAvailable()) error_.clear();
+    }
+
+    PerfCounters::~PerfCounters()
+    {
+        for (const int file : files_)
+        {
+            if (file >= 0) close(file);
+        }
+    }
+
+    // value, time enabled and time running of a counter including its exited child threads, false if it can not be read
+    static auto ReadCounter(const int file, std::array<uint64_t, 3> &values) -> bool
+    {
+        return file >= 0 && read(file, values.data(), sizeof(values)) == static_cast<ssize_t>(sizeof(values));
+    }
+
+    auto PerfCounters::Start() -> void
+    {
+        for (size_t i = 0; i < PerfEventCount; ++i)
+        {
+            if (!ReadCounter(files_[i], start_[i])) continue;
+            ioctl(files_[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    auto PerfCounters::Stop() -> PerfSample
+    {
+        for (const int file : files_)
+        {
+            if (file >= 0) ioctl(file, PERF_EVENT_IOC_DISABLE, 0);
+        }
+
+        PerfSample sample;
+        for (size_t i = 0; i < PerfEventCount; ++i)
+        {
+            std::array<uint64_t, 3> values{};
+            if (!ReadCounter(files_[i], values)) continue;
+
+            const uint64_t count   = values[0] - start_[i][0];
+            const uint64_t enabled = values[1] - start_[i][1];
+            const uint64_t running = values[2] - start_[i][2];
+            if (running == 0) continue;
+
+            // the kernel multiplexes more events than hardware counters, extrapolate to the enabled time
+            const double scale = static_cast<double>(enabled) / static_cast<double>(running);
+            sample.counts[i] = static_cast<uint64_t>(static_cast<double>(count) * std::max(scale, 1.0));
+            sample.valid[i]  = true;
+        }
+        return sample;
+    }
+#else
+    PerfCounters::PerfCounters()
+        : error_("Hardware performance counters are only supported on Linux")
+    {
+        files_.fill(-1);
+    }
+
+    PerfCounters::~PerfCounters() = default;
+
+    auto PerfCounters::Start() -> void
+    {
+    }
+
+    auto PerfCounters::Stop() -> PerfSample
+    {
+        return {};
+    }
+#endif
+
+    auto PerfCounters::IsAvailable() const -> bool
+    {
+        return std::ranges::any_of(files_, [](const int file) { return file >= 0; });
+    }
+}
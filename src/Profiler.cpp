@@ -0,0 +1,188 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <ostream>
+
+#include "Error.hpp"
+
+namespace FlightPath::Profiler
+{
+    static Phase root{.name = "total"};
+
+    // the phase of the innermost alive timer
+    static Phase *current = &root;
+
+    // smallest duration of a bucket
+    static auto GetBucketBegin(const size_t bucket) -> uint64_t
+    {
+        if (bucket < 4) return bucket;
+        const size_t exponent = bucket / 4 + 1;
+        return (4 + bucket % 4) << (exponent - 2);
+    }
+
+    auto GetBucket(const uint64_t duration_ns) -> size_t
+    {
+        if (duration_ns < 4) return static_cast<size_t>(duration_ns);
+
+        // the highest bit selects the power of two, the next two bits the quarter within it
+        const size_t exponent = static_cast<size_t>(std::bit_width(duration_ns)) - 1;
+        const size_t quarter  = static_cast<size_t>(duration_ns >> (exponent - 2)) & 3;
+        return 4 * (exponent - 1) + quarter;
+    }
+
+    auto Phase::Add(const uint64_t duration_ns) -> void
+    {
+        ++count;
+        total_ns += duration_ns;
+        min_ns = std::min(min_ns, duration_ns);
+        max_ns = std::max(max_ns, duration_ns);
+        ++histogram[GetBucket(duration_ns)];
+    }
+
+    auto Phase::GetPercentile(const double percentile) const -> uint64_t
+    {
+        if (count == 0) return 0;
+        if (percentile <= 0.0)   return min_ns;
+        if (percentile >= 100.0) return max_ns;
+
+        const auto rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count)));
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < BucketCount; ++bucket)
+        {
+            seen += histogram[bucket];
+            if (seen >= std::max<uint64_t>(rank, 1))
+            {
+                // middle of the bucket
+                const uint64_t begin = GetBucketBegin(bucket);
+                const uint64_t end   = bucket + 1 < BucketCount ? GetBucketBegin(bucket + 1) : begin;
+                return std::clamp(begin + (end - begin) / 2, min_ns, max_ns);
+            }
+        }
+        return max_ns;
+    }
+
+    auto Phase::GetSelfTime() const -> uint64_t
+    {
+        uint64_t nested = 0;
+        for (const auto &child : children) nested += child->total_ns;
+        return total_ns - std::min(nested, total_ns);
+    }
+
+    auto GetRoot() -> const Phase&
+    {
+        // the root is a single call spanning its outermost phases
+        uint64_t total_ns = 0;
+        for (const auto &child : root.children) total_ns += child->total_ns;
+
+        root.count    = 0;
+        root.total_ns = 0;
+        root.min_ns   = UINT64_MAX;
+        root.max_ns   = 0;
+        root.histogram.fill(0);
+        if (!root.children.empty()) root.Add(total_ns);
+        return root;
+    }
+
+    auto Reset() -> void
+    {
+        Ensure(current == &root, "Profiler: Reset while phase {} is timed", current->name);
+        root.children.clear();
+    }
+
+    ScopedTimer::ScopedTimer(const std::string_view name)
+    {
+        auto &children = current->children;
+        auto it = std::ranges::find_if(children, [name](const auto &child) { return child->name == name; });
+        if (it == children.end())
+        {
+            children.push_back(std::make_unique<Phase>(Phase{.name = std::string(name), .parent = current}));
+            it = children.end() - 1;
+        }
+
+        phase_  = it->get();
+        current = phase_;
+        start_  = std::chrono::steady_clock::now();
+    }
+
+    ScopedTimer::~ScopedTimer()
+    {
+        const auto end = std::chrono::steady_clock::now();
+        phase_->Add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_).count()));
+        current = phase_->parent;
+    }
+
+    // durations in the unit that keeps them readable
+    static auto FormatDuration(const uint64_t ns) -> std::string
+    {
+        if (ns < 10'000)         return std::format("{} ns", ns);
+        if (ns < 10'000'000)     return std::format("{:.1f} us", static_cast<double>(ns) * 1e-3);
+        if (ns < 10'000'000'000) return std::format("{:.1f} ms", static_cast<double>(ns) * 1e-6);
+        return std::format("{:.2f} s", static_cast<double>(ns) * 1e-9);
+    }
+
+    static auto WriteSummary(std::ostream &output, const Phase &phase, const uint64_t total_ns, const size_t depth) -> void
+    {
+        const double share = total_ns > 0 ? 100.0 * static_cast<double>(phase.total_ns) / static_cast<double>(total_ns) : 0.0;
+        const std::string name = std::string(2 * depth, ' ') + phase.name;
+        output << std::format("{:<28} {:>10} {:>11} {:>6.1f}% {:>11} {:>11} {:>11} {:>11} {:>11}\n",
+            name, phase.count, FormatDuration(phase.total_ns), share, FormatDuration(phase.GetSelfTime()),
+            FormatDuration(phase.count > 0 ? phase.total_ns / phase.count : 0),
+            FormatDuration(phase.GetPercentile(50.0)), FormatDuration(phase.GetPercentile(90.0)), FormatDuration(phase.GetPercentile(99.0)));
+
+        for (const auto &child : phase.children)
+        {
+            WriteSummary(output, *child, total_ns, depth + 1);
+        }
+    }
+
+    auto WriteSummary(std::ostream &output) -> void
+    {
+        const Phase &total = GetRoot();
+        output << std::format("{:<28} {:>10} {:>11} {:>7} {:>11} {:>11} {:>11} {:>11} {:>11}\n",
+            "phase", "count", "total", "share", "self", "mean", "p50", "p90", "p99");
+        WriteSummary(output, total, total.total_ns, 0);
+    }
+
+    static auto WriteJSON(std::ostream &output, const Phase &phase, const size_t depth) -> void
+    {
+        const std::string indent(2 * depth, ' ');
+        output << std::format(
+            "{0}{{\n"
+            "{0}  \"name\": \"{1}\",\n"
+            "{0}  \"count\": {2},\n"
+            "{0}  \"total_ns\": {3},\n"
+            "{0}  \"self_ns\": {4},\n"
+            "{0}  \"min_ns\": {5},\n"
+            "{0}  \"max_ns\": {6},\n"
+            "{0}  \"mean_ns\": {7},\n"
+            "{0}  \"p50_ns\": {8},\n"
+            "{0}  \"p90_ns\": {9},\n"
+            "{0}  \"p99_ns\": {10},\n"
+            "{0}  \"children\": [",
+            indent, phase.name, phase.count, phase.total_ns, phase.GetSelfTime(),
+            phase.count > 0 ? phase.min_ns : 0, phase.max_ns, phase.count > 0 ? phase.total_ns / phase.count : 0,
+            phase.GetPercentile(50.0), phase.GetPercentile(90.0), phase.GetPercentile(99.0));
+
+        for (size_t i = 0; i < phase.children.size(); ++i)
+        {
+            output << (i == 0 ? "\n" : ",\n");
+            WriteJSON(output, *phase.children[i], depth + 2);
+        }
+        output << std::format("{}]\n{}}}", phase.children.empty() ? "" : "\n" + indent + "  ", indent);
+    }
+
+    auto WriteJSON(const std::string &path) -> void
+    {
+        std::ofstream file(path);
+        Ensure(file.is_open(), "Profiler: Could not open file {}", path);
+
+        WriteJSON(file, GetRoot(), 0);
+        file << '\n';
+        file.close();
+        Ensure(!file.fail(), "Profiler: Could not write file {}", path);
+    }
+}
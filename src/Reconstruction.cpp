@@ -0,0 +1,153 @@
+#include "Reconstruction.hpp"
+
+#include "Error.hpp"
+#include "Mat4.hpp"
+
+namespace FlightPath
+{
+    auto GetInitialState(const Entry &entry) -> InitialState
+    {
+        return InitialState{
+            .position = Position{.longitude = entry.longitude, .latitude = entry.latitude, .altitude = entry.altitude},
+            .attitude = Attitude{.heading = entry.true_heading, .pitch = entry.pitch, .roll = entry.roll},
+            .velocity = Vec3<double>(entry.v_x, entry.v_y, entry.v_z)};
+    }
+
+    Reconstructor::Reconstructor(const InitialState &state)
+    {
+        Reset(state);
+    }
+
+    auto Reconstructor::Reset(const InitialState &state) -> void
+    {
+        frame_ = ReferenceFrame();
+        frame_.SetPosition(state.position);
+        frame_.SetAttitude(state.attitude);
+        velocity_ = state.velocity;
+    }
+
+    auto Reconstructor::Integrate(const Vec3<double> &acceleration, const Vec3<double> &angular_velocity, const double dt) -> void
+    {
+        constexpr Mat4<double> eye_4{
+            1.0, 0.0, 0.0, 0.0,
+            0.0, 1.0, 0.0, 0.0,
+            0.0, 0.0, 1.0, 0.0,
+            0.0, 0.0, 0.0, 1.0
+        };
+
+        const Vec3<double> &ob  = angular_velocity;
+        const Vec3<double> vb_n = velocity_;
+
+        const Vec3<double> dv_dt_b = acceleration - ob.Cross(vb_n);
+
+        const Mat4<double> twist_matrix = {
+              0.0, -ob.z,  ob.y, vb_n.x,
+             ob.z,   0.0, -ob.x, vb_n.y,
+            -ob.y,  ob.x,   0.0, vb_n.z,
+              0.0,   0.0,   0.0,    0.0
+        };
+
+        // integration yields velocity and new position + attitude
+        velocity_ = vb_n + dv_dt_b * dt;
+        frame_.Dot(eye_4 + twist_matrix * dt);
+    }
+
+    // output[0] is the initial state, output[i+1] the state after sample i, sample(i) yields (time, acceleration, angular velocity)
+    template <typename Sample>
+    static auto ReconstructSamples(const size_t count, const Sample &sample, const InitialState &state, const std::span<Pose> output) -> void
+    {
+        Ensure(count > 0, "Reconstruct: No input samples");
+        Ensure(output.size() == count, "Reconstruct: Output holds {} poses, expected {}", output.size(), count);
+
+        Reconstructor reconstructor(state);
+        double time = sample.Time(0);
+        output[0] = Pose{.time = time, .position = state.position, .attitude = state.attitude, .velocity = state.velocity};
+
+        for (size_t i = 0; i + 1 < count; ++i)
+        {
+            const double next_time = sample.Time(i + 1);
+            reconstructor.Step(sample.Acceleration(i), sample.AngularVelocity(i), next_time - time);
+            time = next_time;
+
+            output[i + 1] = Pose{
+                .time     = time,
+                .position = reconstructor.GetPosition(),
+                .attitude = reconstructor.GetAttitude(),
+                .velocity = reconstructor.GetVelocity()};
+        }
+    }
+
+    struct EntrySamples
+    {
+        std::span<const Entry> entries;
+
+        auto Time(const size_t i)            const -> double       { return entries[i].time; }
+        auto Acceleration(const size_t i)    const -> Vec3<double> { return Vec3<double>(entries[i].a_x, entries[i].a_y, entries[i].a_z); }
+        auto AngularVelocity(const size_t i) const -> Vec3<double> { return Vec3<double>(entries[i].omega_x, entries[i].omega_y, entries[i].omega_z); }
+    };
+
+    struct ColumnSamples
+    {
+        ImuColumns columns;
+
+        auto Time(const size_t i)            const -> double       { return columns.time[i]; }
+        auto Acceleration(const size_t i)    const -> Vec3<double> { return Vec3<double>(columns.a_x[i], columns.a_y[i], columns.a_z[i]); }
+        auto AngularVelocity(const size_t i) const -> Vec3<double> { return Vec3<double>(columns.omega_x[i], columns.omega_y[i], columns.omega_z[i]); }
+    };
+
+    auto Reconstruct(const std::span<const Entry> input, const InitialState &state, const std::span<Pose> output) -> void
+    {
+        ReconstructSamples(input.size(), EntrySamples{input}, state, output);
+    }
+
+    // returns the common length of the columns
+    static auto GetLength(const ImuColumns &input) -> size_t
+    {
+        const size_t count = input.time.size();
+        for (const auto column : {input.a_x, input.a_y, input.a_z, input.omega_x, input.omega_y, input.omega_z})
+        {
+            Ensure(column.size() == count, "Reconstruct: Columns differ in length ({} and {})", column.size(), count);
+        }
+        return count;
+    }
+
+    auto Reconstruct(const ImuColumns &input, const InitialState &state, const std::span<Pose> output) -> void
+    {
+        ReconstructSamples(GetLength(input), ColumnSamples{input}, state, output);
+    }
+
+    // the lazy counterpart of ReconstructSamples, the arguments are copied into the coroutine frame
+    template <typename Sample>
+    static auto GenerateSamples(const size_t count, const Sample sample, const InitialState state) -> Generator<Pose>
+    {
+        if (count == 0) co_return;
+
+        Reconstructor reconstructor(state);
+        double time = sample.Time(0);
+        co_yield Pose{.time = time, .position = state.position, .attitude = state.attitude, .velocity = state.velocity};
+
+        for (size_t i = 0; i + 1 < count; ++i)
+        {
+            const double next_time = sample.Time(i + 1);
+            reconstructor.Step(sample.Acceleration(i), sample.AngularVelocity(i), next_time - time);
+            time = next_time;
+
+            co_yield Pose{
+                .time     = time,
+                .position = reconstructor.GetPosition(),
+                .attitude = reconstructor.GetAttitude(),
+                .velocity = reconstructor.GetVelocity()};
+        }
+    }
+
+    auto GeneratePoses(const std::span<const Entry> input, const InitialState state) -> Generator<Pose>
+    {
+        return GenerateSamples(input.size(), EntrySamples{input}, state);
+    }
+
+    auto GeneratePoses(const ImuColumns &input, const InitialState state) -> Generator<Pose>
+    {
+        // checked here, a coroutine would only throw on the first increment
+        return GenerateSamples(GetLength(input), ColumnSamples{input}, state);
+    }
+}
@@ -7,6 +7,12 @@
 #include "Error.hpp"
 #include "Units.hpp"
 #include "KML.hpp"
+#include "Columnar.hpp"
+#include "KMLLod.hpp"
+#include "KMLSink.hpp"
+#include "KMLWriter.hpp"
+#include "Trace.hpp"
+#include "TrajectoryStore.hpp"
 
 namespace FlightPath
 {
@@ -46,8 +52,13 @@ namespace FlightPath
         return input_stream;
     }
 
+    // defined here, where TrajectoryStore is complete
+    Recorder::Recorder()  = default;
+    Recorder::~Recorder() = default;
+
     auto Recorder::ReadFile(const std::string &path) -> void
     {
+        Trace::Span span("Recorder::ReadFile");
         std::ifstream file(path);
         
         Ensure(file.is_open(), "Recorder: Could not open file {}", path);
@@ -59,13 +70,32 @@ namespace FlightPath
         }
         
         // copy first line of input to output
-        output_data_.push_back(input_data_[0]);
+        output_size_ = 1;
+        if (retain_output_)
+        {
+            output_data_.push_back(input_data_[0]);
+        }
+    }
+
+    auto Recorder::SetRetainOutput(const bool retain) -> void
+    {
+        // the first output entry is copied (or not) by ReadFile
+        Ensure(input_data_.empty(), "Recorder: SetRetainOutput must be called before ReadFile");
+        retain_output_ = retain;
+    }
+
+    auto Recorder::ReserveOutput(const size_t capacity) -> void
+    {
+        if (retain_output_)
+        {
+            output_data_.reserve(capacity);
+        }
     }
 
-    auto Recorder::WriteData(const Position &position, const Attitude &attitude, const Vec3<double> &velocity) -> void
+    auto Recorder::WriteData(const Position &position, const Attitude &attitude, const Vec3<double> &velocity) -> Entry
     {
         // start with a copy of the input data at n and overwrite fields with our calculation
-        Entry entry = input_data_[output_data_.size()];
+        Entry entry = input_data_[output_size_];
         
         entry.longitude    = position.longitude;
         entry.latitude     = position.latitude;
@@ -78,40 +108,84 @@ namespace FlightPath
         entry.v_x          = velocity.x;
         entry.v_y          = velocity.y;
         entry.v_z          = velocity.z;
-        
-        output_data_.push_back(entry);
+
+        ++output_size_;
+        if (retain_output_)
+        {
+            output_data_.push_back(entry);
+        }
+        if (store_)
+        {
+            store_->Append(entry);
+        }
+        return entry;
     }
 
-    auto Recorder::DumpKML(const std::string &path) const -> void
+    auto Recorder::OpenStore(const std::string &path) -> void
     {
-        std::ofstream file(path);
-        
-        Ensure(file.is_open(), "Recorder: Could not open file {}", path);
+        Ensure(!input_data_.empty(), "Recorder: No data to store, call ReadFile first");
 
-        file << KML::Header;
+        store_ = std::make_unique<TrajectoryStore>(path, input_data_.size());
+        store_->Append(input_data_[0]);
+    }
 
-        file << KML::OpenOriginalDataset;
-        for (auto &entry : input_data_ | std::views::stride(100))
-        {
-            file << "            " 
-                 << std::format("{:12.9f}, {:12.9f}, {:6.1f}\n",
-                    rad2deg<double>(entry.longitude),
-                    rad2deg<double>(entry.latitude),
-                    entry.altitude);
-        }
-        file << KML::CloseDataset;
+    // writes one line of a <coordinates> element
+    static auto WriteCoordinate(KMLWriter &writer, const Entry &entry) -> void
+    {
+        writer.WriteCoordinate(
+            rad2deg<double>(entry.longitude),
+            rad2deg<double>(entry.latitude),
+            entry.altitude);
+    }
+
+    // writes both datasets, select(data, writer) writes the coordinates of one dataset
+    template <typename Select>
+    static auto WriteKML(const std::string &path, const EntryVector &input_data, const EntryVector &output_data, Select select) -> void
+    {
+        KMLWriter writer(path);
+
+        writer.Write(KML::Header);
 
-        file << KML::OpenReconstructedDataset;
-        for (auto &entry : output_data_ | std::views::stride(100))
+        writer.Write(KML::OpenOriginalDataset);
+        select(input_data, writer);
+        writer.Write(KML::CloseDataset);
+
+        writer.Write(KML::OpenReconstructedDataset);
+        select(output_data, writer);
+        writer.Write(KML::CloseDataset);
+
+        writer.Write(KML::Footer);
+        writer.Flush();
+    }
+
+    auto Recorder::DumpKML(const std::string &path, const size_t stride) const -> void
+    {
+        Ensure(stride > 0, "Recorder: Invalid KML stride {}", stride);
+
+        WriteKML(path, input_data_, output_data_, [stride](const EntryVector &data, KMLWriter &writer)
         {
-            file << "            " 
-                 << std::format("{:12.9f}, {:12.9f}, {:6.1f}\n", 
-                    rad2deg<double>(entry.longitude),
-                    rad2deg<double>(entry.latitude),
-                    entry.altitude);
-        }
-        file << KML::CloseDataset;
+            for (auto &entry : data | std::views::stride(stride))
+            {
+                WriteCoordinate(writer, entry);
+            }
+        });
+    }
+
+    auto Recorder::DumpSimplifiedKML(const std::string &path, const double tolerance) const -> void
+    {
+        KMLSink sink(path, tolerance);
+        sink.WriteTrack(KML::OpenOriginalDataset, input_data_);
+        sink.WriteTrack(KML::OpenReconstructedDataset, output_data_);
+        sink.Close();
+    }
 
-        file << KML::Footer;
+    auto Recorder::DumpLodKML(const std::string &directory, const LodSettings &settings) const -> void
+    {
+        ExportLodKML(directory, input_data_, output_data_, settings);
+    }
+
+    auto Recorder::DumpColumnar(const std::string &path) const -> void
+    {
+        Columnar::Write(path, output_data_);
     }
 }
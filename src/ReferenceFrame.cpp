@@ -9,7 +9,7 @@
 
 namespace
 {
-    static const FlightPath::Mat4<double> IDENTITY_MAT4{
+    constexpr FlightPath::Mat4<double> IDENTITY_MAT4{
         1.0, 0.0, 0.0, 0.0,
         0.0, 1.0, 0.0, 0.0,
         0.0, 0.0, 1.0, 0.0,
@@ -175,6 +175,18 @@ namespace FlightPath
         });
     }
 
+    auto ReferenceFrame::GetEarthCoordinates(const Position position) -> Vec3<double>
+    {
+        using std::sin;
+        using std::cos;
+
+        const double L = position.longitude;
+        const double B = position.latitude;
+        const double r = earth_radius_ + position.altitude;
+
+        return Vec3<double>(r*cos(L)*cos(B), r*sin(L)*cos(B), r*sin(B));
+    }
+
     auto ReferenceFrame::GetGeodetic2BodyfixedMatrix(const Position position) const -> Mat4<double>
     {
         const auto  iG2E = GetGeodetic2EarthMatrix(position);
@@ -214,19 +226,19 @@ namespace FlightPath
     
     auto ReferenceFrame::PrintPosition(const Position position) const -> void
     {
-        Log::Info(std::format("{}", position));
+        Log::Info("{}", position);
     }
 
     auto ReferenceFrame::PrintAttitude(const Attitude attitude) const -> void
     {
-        Log::Info(std::format("{}", attitude));
+        Log::Info("{}", attitude);
     }
 
-    auto ReferenceFrame::Orthonormalize() -> void
+    auto ReferenceFrame::Orthonormalize() -> i32
     {
         constexpr double max_error = 1e-15;
         constexpr double max_error_sq = max_error * max_error;
-        constexpr i32 max_iter = 10;
+        constexpr i32 max_iter = MaxOrthonormalizeIterations;
         constexpr bool use_fast_approximation = true;
 
         constexpr double ONE_THIRD = 1.0 / 3.0;
@@ -242,7 +254,8 @@ namespace FlightPath
 
         double error_sq = ONE_THIRD * (d_ij*d_ij + d_jk*d_jk + d_ki*d_ki);
 
-        for (i32 iter = 0; iter < max_iter; ++iter)
+        i32 iter = 0;
+        for (; iter < max_iter; ++iter)
         {
             if (error_sq < max_error_sq) break;
 
@@ -290,9 +303,10 @@ namespace FlightPath
         frame_.SetColumn(0, c_i);
         frame_.SetColumn(1, c_j);
         frame_.SetColumn(2, c_k);
+        return iter;
     }
 
-    auto ReferenceFrame::GetOrthogonalError() -> double
+    auto ReferenceFrame::GetOrthogonalError() const -> double
     {
         constexpr double ONE_THIRD = 1.0/3.0;
         // Get vectors from rotation part of frame
@@ -308,7 +322,7 @@ namespace FlightPath
         return std::sqrt(ONE_THIRD * (d_ij*d_ij + d_jk*d_jk + d_ki*d_ki));
     }
 
-    auto ReferenceFrame::GetLengthError() -> double
+    auto ReferenceFrame::GetLengthError() const -> double
     {
         constexpr double ONE_THIRD = 1.0/3.0;
         // Get vectors from rotation part of frame
@@ -0,0 +1,232 @@
+#include "Simplify.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <utility>
+
+#include "Error.hpp"
+#include "Parallel.hpp"
+#include "ReferenceFrame.hpp"
+#include "Trace.hpp"
+
+namespace FlightPath
+{
+    // squared distance of point p to the line segment a-b
+    static auto SquaredSegmentDistance(const Vec3<double> &p, const Vec3<double> &a, const Vec3<double> &b) -> double
+    {
+        const Vec3<double> ab = b - a;
+        const Vec3<double> ap = p - a;
+
+        const double length_squared = ab.LengthSquared();
+        const double t = length_squared > 0.0 ? std::clamp(ap.Dot(ab) / length_squared, 0.0, 1.0) : 0.0;
+
+        const Vec3<double> d = ap - ab * t;
+        return d.LengthSquared();
+    }
+
+    // Douglas-Peucker on points[first..last], marks the kept points in between (first and last are kept by the caller)
+    // note: uses an explicit stack instead of recursion, so long straight legs can not overflow the call stack
+    static auto SimplifyRange(const Vec3Array<double> &points, const double tolerance_squared, const size_t first, const size_t last, std::vector<char> &keep) -> void
+    {
+        std::vector<std::pair<size_t, size_t>> stack{{first, last}};
+
+        while (!stack.empty())
+        {
+            const auto [begin, end] = stack.back();
+            stack.pop_back();
+
+            const Vec3<double> a = points.Get(begin);
+            const Vec3<double> b = points.Get(end);
+
+            double max_distance = 0.0;
+            size_t max_index    = begin;
+            for (size_t i = begin + 1; i < end; ++i)
+            {
+                const double distance = SquaredSegmentDistance(points.Get(i), a, b);
+                if (distance > max_distance)
+                {
+                    max_distance = distance;
+                    max_index    = i;
+                }
+            }
+
+            if (max_distance > tolerance_squared)
+            {
+                keep[max_index] = 1;
+                stack.emplace_back(begin, max_index);
+                stack.emplace_back(max_index, end);
+            }
+        }
+    }
+
+    auto Simplify(const Vec3Array<double> &points, const double tolerance, const size_t segment_size) -> std::vector<size_t>
+    {
+        Ensure(tolerance >= 0.0, "Simplify: Invalid tolerance {}", tolerance);
+        Ensure(segment_size >= 2, "Simplify: Invalid segment size {}", segment_size);
+
+        const size_t n = points.size();
+        if (n <= 2)
+        {
+            std::vector<size_t> indices(n);
+            for (size_t i = 0; i < n; ++i) indices[i] = i;
+            return indices;
+        }
+
+        // segment boundaries are always kept, every segment only writes the flags strictly inside of it
+        // note: std::vector<char> instead of std::vector<bool>, so that threads never share a byte
+        const size_t segment_count = (n - 2) / (segment_size - 1) + 1;
+        std::vector<char> keep(n, 0);
+        for (size_t s = 0; s < segment_count; ++s)
+        {
+            keep[s * (segment_size - 1)] = 1;
+        }
+        keep[n - 1] = 1;
+
+        const auto simplify_segment = [&](const size_t s)
+        {
+            Trace::Span span("Simplify segment");
+            const size_t first = s * (segment_size - 1);
+            const size_t last  = std::min(first + segment_size - 1, n - 1);
+            SimplifyRange(points, tolerance * tolerance, first, last, keep);
+        };
+
+        ParallelFor(segment_count, simplify_segment);
+
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (keep[i]) indices.push_back(i);
+        }
+        return indices;
+    }
+
+    auto SimplifyTrack(const std::span<const Entry> entries, const double tolerance, const size_t segment_size) -> std::vector<size_t>
+    {
+        Vec3Array<double> points;
+        points.Reserve(entries.size());
+        for (const auto &entry : entries)
+        {
+            points.PushBack(ReferenceFrame::GetEarthCoordinates(
+                Position{
+                    .longitude = entry.longitude,
+                    .latitude  = entry.latitude,
+                    .altitude  = entry.altitude}
+            ));
+        }
+
+        return Simplify(points, tolerance, segment_size);
+    }
+
+    // angle between two vectors in rad, also accurate for almost parallel vectors
+    static auto GetAngle(const Vec3<double> &u, const Vec3<double> &v) -> double
+    {
+        return std::atan2(u.Cross(v).Length(), u.Dot(v));
+    }
+
+    StreamingSimplifier::StreamingSimplifier(const double tolerance, const size_t window_size)
+        : tolerance_(tolerance), tolerance_squared_(tolerance * tolerance), window_size_(window_size)
+    {
+        Ensure(tolerance >= 0.0, "StreamingSimplifier: Invalid tolerance {}", tolerance);
+        Ensure(window_size > 0, "StreamingSimplifier: Invalid window size {}", window_size);
+        window_.reserve(window_size);
+    }
+
+    auto StreamingSimplifier::ClearWindow() -> void
+    {
+        window_.clear();
+        cone_axis_     = Vec3<double>(1.0, 0.0, 0.0);
+        cone_angle_    = std::numbers::pi;
+        window_radius_ = 0.0;
+    }
+
+    auto StreamingSimplifier::AddToWindow(const Vec3<double> &point) -> void
+    {
+        window_.push_back(point);
+
+        const Vec3<double> offset = point - anchor_;
+        const double radius = offset.Length();
+        window_radius_ = std::max(window_radius_, radius);
+
+        // points within tolerance of the anchor are represented by any segment
+        if (radius <= tolerance_ || cone_angle_ < 0.0) return;
+
+        // segments within this angle pass at most tolerance from the point (with a margin for rounding),
+        // as long as they are at least as long as the distance of the point to the anchor
+        const Vec3<double> direction = offset * (1.0 / radius);
+        const double angle = std::asin(tolerance_ * (1.0 - 1e-9) / radius);
+
+        // the largest cone inside the intersection of both cones
+        const double between = GetAngle(cone_axis_, direction);
+        if (between + angle <= cone_angle_)
+        {
+            cone_axis_  = direction;
+            cone_angle_ = angle;
+        }
+        else if (between + cone_angle_ <= angle)
+        {
+            // the cone is already narrower
+        }
+        else if (between >= cone_angle_ + angle)
+        {
+            cone_angle_ = -1.0;
+        }
+        else
+        {
+            // rotate the axis towards the direction, to the middle of the overlap
+            const double rotation = (between - angle + cone_angle_) / 2.0;
+            const Vec3<double> normal = (direction - cone_axis_ * std::cos(between)).Normalized();
+            cone_axis_  = (cone_axis_ * std::cos(rotation) + normal * std::sin(rotation)).Normalized();
+            cone_angle_ = (cone_angle_ - between + angle) / 2.0;
+        }
+    }
+
+    auto StreamingSimplifier::IsInCone(const Vec3<double> &point) const -> bool
+    {
+        const Vec3<double> offset = point - anchor_;
+        const double radius = offset.Length();
+        if (cone_angle_ < 0.0 || radius < window_radius_) return false;
+
+        return window_.empty() || (radius > 0.0 && GetAngle(cone_axis_, offset * (1.0 / radius)) <= cone_angle_);
+    }
+
+    auto StreamingSimplifier::Push(const Vec3<double> &point) -> bool
+    {
+        if (!has_anchor_)
+        {
+            anchor_     = point;
+            has_anchor_ = true;
+            ClearWindow();
+            return false;
+        }
+
+        // extend the window as long as the segment anchor -> point represents all points in between,
+        // the cone decides in constant time, only if it can not every point of the window is checked
+        bool fits = window_.size() < window_size_;
+        if (fits && !IsInCone(point))
+        {
+            for (size_t i = 0; fits && i < window_.size(); ++i)
+            {
+                fits = SquaredSegmentDistance(window_[i], anchor_, point) <= tolerance_squared_;
+            }
+        }
+
+        if (fits)
+        {
+            AddToWindow(point);
+            return false;
+        }
+
+        // the previous point becomes the new anchor
+        anchor_ = window_.back();
+        ClearWindow();
+        AddToWindow(point);
+        return true;
+    }
+
+    auto StreamingSimplifier::Reset() -> void
+    {
+        has_anchor_ = false;
+        ClearWindow();
+    }
+}
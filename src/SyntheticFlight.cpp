@@ -0,0 +1,206 @@
+#include "SyntheticFlight.hpp"
+
+#include <charconv>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "Error.hpp"
+#include "Reconstruction.hpp"
+#include "Vec3.hpp"
+
+namespace FlightPath
+{
+    // body rates of the script at time t (rad/s), the script repeats
+    class Script
+    {
+    public:
+        explicit Script(const std::vector<FlightSegment> &segments)
+            : segments_(segments)
+        {
+            for (const auto &segment : segments_)
+            {
+                Ensure(segment.duration > 0.0, "WriteSyntheticFlight: Invalid segment duration {}", segment.duration);
+                cycle_ += segment.duration;
+            }
+        }
+
+        auto GetRates(const double t) const -> Vec3<double>
+        {
+            double local = std::fmod(t, cycle_);
+            for (const auto &segment : segments_)
+            {
+                if (local < segment.duration)
+                {
+                    return GetRates(segment, local);
+                }
+                local -= segment.duration;
+            }
+            return Vec3<double>(0.0, 0.0, 0.0);
+        }
+
+    private:
+        static auto GetRates(const FlightSegment &segment, const double t) -> Vec3<double>
+        {
+            switch (segment.maneuver)
+            {
+                case FlightSegment::Maneuver::Cruise:
+                    return Vec3<double>(0.0, 0.0, 0.0);
+
+                case FlightSegment::Maneuver::Climb:
+                {
+                    const double ramp = 0.2 * segment.duration;
+                    const double rate = segment.angle / ramp;
+                    if (t < ramp)                    return Vec3<double>(0.0,  rate, 0.0);
+                    if (t >= segment.duration - ramp) return Vec3<double>(0.0, -rate, 0.0);
+                    return Vec3<double>(0.0, 0.0, 0.0);
+                }
+
+                case FlightSegment::Maneuver::Turn:
+                    return Vec3<double>(0.0, 0.0, segment.angle / segment.duration);
+            }
+            return Vec3<double>(0.0, 0.0, 0.0);
+        }
+
+    private:
+        std::vector<FlightSegment> segments_;
+        double cycle_ = 0.0;
+    };
+
+    // the value as it is read back from a field with the given precision
+    static auto Quantize(const double value, const int precision) -> double
+    {
+        char text[64];
+        const auto result = std::to_chars(text, text + sizeof(text), value, std::chars_format::fixed, precision);
+        Ensure(result.ec == std::errc{}, "WriteSyntheticFlight: Could not format {}", value);
+
+        double parsed = 0.0;
+        std::from_chars(text, result.ptr, parsed);
+        return parsed;
+    }
+
+    // formats lines of the Recorder format, every field returns the value as it will be read back
+    class LineWriter
+    {
+    public:
+        auto Field(const double value, const int width, const int precision) -> double
+        {
+            char text[64];
+            const auto result = std::to_chars(text, text + sizeof(text), value, std::chars_format::fixed, precision);
+            Ensure(result.ec == std::errc{}, "WriteSyntheticFlight: Could not format {}", value);
+
+            const auto length = static_cast<int>(result.ptr - text);
+            line_.append(static_cast<size_t>(std::max(width - length, 0) + 1), ' ');
+            line_.append(text, result.ptr);
+
+            double parsed = 0.0;
+            std::from_chars(text, result.ptr, parsed);
+            return parsed;
+        }
+
+        auto Angle(const double radians, const int width, const int precision) -> double
+        {
+            return deg2rad<double>(Field(rad2deg<double>(radians), width, precision));
+        }
+
+        auto EndLine() -> void { line_ += '\n'; }
+
+        auto GetText() -> std::string& { return line_; }
+
+    private:
+        std::string line_;
+    };
+
+    auto WriteSyntheticFlight(const std::string &path, const size_t sample_count, const SyntheticFlightSettings &settings) -> void
+    {
+        Ensure(settings.sample_rate > 0.0 && settings.speed > 0.0, "WriteSyntheticFlight: Invalid sample rate {} or speed {}", settings.sample_rate, settings.speed);
+        Ensure(!settings.script.empty(), "WriteSyntheticFlight: Empty script");
+        const Script script(settings.script);
+
+        std::ofstream file(path, std::ios::binary);
+        Ensure(file.is_open(), "WriteSyntheticFlight: Could not open file {}", path);
+
+        constexpr size_t flush_size = 1 << 20;
+        constexpr double attitude_gain = 0.5; // 1/s
+
+        LineWriter writer;
+        Reconstructor reconstructor;
+        double scripted_heading = settings.heading;
+        double scripted_pitch   = 0.0;
+
+        const auto get_time = [&settings](const size_t i) { return settings.start_time + static_cast<double>(i) / settings.sample_rate; };
+
+        for (size_t i = 0; i < sample_count; ++i)
+        {
+            const double time = writer.Field(get_time(i), 7, 2);
+
+            // the reconstruction starts from the pose and velocity of the first line as read from the file
+            Position position;
+            Attitude attitude;
+            if (i == 0)
+            {
+                position = settings.start;
+                attitude = Attitude{.heading = settings.heading, .pitch = 0.0, .roll = 0.0};
+            }
+            else
+            {
+                position = reconstructor.GetPosition();
+                attitude = reconstructor.GetAttitude();
+            }
+
+            position.longitude = writer.Angle(position.longitude, 14, 9);
+            position.latitude  = writer.Angle(position.latitude,  13, 9);
+            position.altitude  = writer.Field(position.altitude,   7, 1);
+            attitude.heading   = writer.Angle(attitude.heading,    5, 1);
+            attitude.pitch     = writer.Angle(attitude.pitch,      5, 1);
+            attitude.roll      = writer.Angle(attitude.roll,       6, 1);
+
+            const Vec3<double> &vb = reconstructor.GetVelocity();
+            const Vec3<double> v_line(
+                writer.Field(i == 0 ? settings.speed : vb.x, 6, 1),
+                writer.Field(i == 0 ? 0.0            : vb.y, 6, 1),
+                writer.Field(i == 0 ? 0.0            : vb.z, 6, 1));
+
+            if (i == 0)
+            {
+                reconstructor.Reset(InitialState{.position = position, .attitude = attitude, .velocity = v_line});
+            }
+
+            // rates of the script plus a correction towards the scripted attitude, which compensates the rotation
+            // of the local level frame along the curved earth (otherwise long flights slowly pitch and roll away)
+            const double dt = Quantize(get_time(i + 1), 2) - time;
+            const Vec3<double> rates = script.GetRates(time - settings.start_time);
+            const Vec3<double> correction(
+                -attitude.roll,
+                scripted_pitch - attitude.pitch,
+                std::remainder(scripted_heading - attitude.heading, TWO_PI_d));
+            scripted_heading += rates.z * dt;
+            scripted_pitch   += rates.y * dt;
+
+            const Vec3<double> ob(
+                writer.Angle(rates.x + attitude_gain * correction.x, 9, 3),
+                writer.Angle(rates.y + attitude_gain * correction.y, 9, 3),
+                writer.Angle(rates.z + attitude_gain * correction.z, 9, 3));
+
+            const Vec3<double> a_target = (Vec3<double>(settings.speed, 0.0, 0.0) - vb) * (1.0 / dt) + ob.Cross(vb);
+            const Vec3<double> ab(
+                writer.Field(a_target.x, 9, 5),
+                writer.Field(a_target.y, 9, 5),
+                writer.Field(a_target.z, 9, 5));
+            writer.EndLine();
+
+            // the integration step of Application::Run
+            reconstructor.Step(ab, ob, dt);
+
+            if (writer.GetText().size() >= flush_size)
+            {
+                file.write(writer.GetText().data(), static_cast<std::streamsize>(writer.GetText().size()));
+                writer.GetText().clear();
+            }
+        }
+
+        file.write(writer.GetText().data(), static_cast<std::streamsize>(writer.GetText().size()));
+        file.close();
+        Ensure(!file.fail(), "WriteSyntheticFlight: Could not write file {}", path);
+    }
+}
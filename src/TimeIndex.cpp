@@ -0,0 +1,115 @@
+#include "TimeIndex.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include "Error.hpp"
+
+namespace FlightPath
+{
+    TimeIndex::TimeIndex(const std::span<const Entry> entries, const size_t block_size)
+        : base_(entries.empty() ? nullptr : reinterpret_cast<const std::byte*>(&entries.front().time))
+        , stride_(sizeof(Entry))
+        , size_(entries.size())
+        , block_size_(block_size)
+    {
+        Build();
+    }
+
+    TimeIndex::TimeIndex(const std::span<const double> times, const size_t block_size)
+        : base_(reinterpret_cast<const std::byte*>(times.data()))
+        , stride_(sizeof(double))
+        , size_(times.size())
+        , block_size_(block_size)
+    {
+        Build();
+    }
+
+    auto TimeIndex::Build() -> void
+    {
+        Ensure(size_ > 0, "TimeIndex: No samples");
+        Ensure(block_size_ > 0, "TimeIndex: Invalid block size {}", block_size_);
+
+        skip_.reserve((size_ + block_size_ - 1) / block_size_);
+        for (size_t index = 0; index < size_; index += block_size_)
+        {
+            skip_.push_back(GetTime(index));
+        }
+
+        // only the skip table is checked, a full check would scan the samples the index is meant to avoid
+        const auto descending = std::ranges::adjacent_find(skip_, std::greater<>());
+        Ensure(descending == skip_.end(), "TimeIndex: Times descend at sample {}", static_cast<size_t>(descending - skip_.begin() + 1) * block_size_);
+    }
+
+    auto TimeIndex::GetTime(const size_t index) const -> double
+    {
+        // the samples are not necessarily doubles (e.g. entries), so the time is copied out
+        double time;
+        std::memcpy(&time, base_ + index * stride_, sizeof(double));
+        return time;
+    }
+
+    auto TimeIndex::Search(const double time, const bool inclusive) const -> size_t
+    {
+        // true while the sample is before the searched one
+        const auto before = [time, inclusive](const double sample_time) { return inclusive ? sample_time <= time : sample_time < time; };
+
+        if (!before(GetTime(0)))         return 0;
+        if (before(GetTime(size_ - 1))) return size_;
+
+        // the last block starting before the searched sample, invariant: before(skip_[low]) and !before(skip_[high])
+        size_t low  = 0;
+        size_t high = skip_.size() - 1;
+        if (before(skip_[high]))
+        {
+            low = high;
+        }
+        for (bool interpolate = true; high - low > 1; interpolate = !interpolate)
+        {
+            size_t probe = low + (high - low) / 2;
+            if (interpolate && skip_[high] > skip_[low])
+            {
+                const double fraction = (time - skip_[low]) / (skip_[high] - skip_[low]);
+                probe = std::clamp(low + static_cast<size_t>(fraction * static_cast<double>(high - low)), low + 1, high - 1);
+            }
+
+            if (before(skip_[probe])) low  = probe;
+            else                      high = probe;
+        }
+
+        // the sample lies after the first one of the block and at or before the first one of the next block (or the last sample)
+        size_t first = low * block_size_ + 1;
+        size_t last  = std::min((low + 1) * block_size_, size_ - 1);
+        while (first < last)
+        {
+            const size_t middle = first + (last - first) / 2;
+            if (before(GetTime(middle))) first = middle + 1;
+            else                         last  = middle;
+        }
+        return first;
+    }
+
+    auto TimeIndex::LowerBound(const double time) const -> size_t
+    {
+        return Search(time, false);
+    }
+
+    auto TimeIndex::UpperBound(const double time) const -> size_t
+    {
+        return Search(time, true);
+    }
+
+    auto TimeIndex::FindIndex(const double time) const -> size_t
+    {
+        const size_t after = UpperBound(time);
+        return after > 0 ? after - 1 : 0;
+    }
+
+    auto TimeIndex::FindRange(const double begin_time, const double end_time) const -> TimeRange
+    {
+        const size_t begin = LowerBound(begin_time);
+        const size_t end   = UpperBound(end_time);
+        return TimeRange{.begin = begin, .end = std::max(begin, end)};
+    }
+}
@@ -0,0 +1,187 @@
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace FlightPath::Trace
+{
+    struct Event
+    {
+        const char *name;
+        uint64_t    begin_ns;
+        uint64_t    end_ns;
+    };
+
+    // the events of a thread, moved into the session when the thread ends
+    struct ThreadEvents
+    {
+        uint32_t           index = 0;
+        std::vector<Event> events;
+    };
+
+    struct ThreadBuffer;
+
+    // the open file and the buffers of all threads
+    struct SessionState
+    {
+        std::mutex                            mutex;
+        std::string                           path;
+        std::chrono::steady_clock::time_point start;
+        std::vector<ThreadBuffer*>            buffers;
+        std::vector<ThreadEvents>             finished;
+        uint32_t                              next_thread = 0;
+    };
+
+    static auto GetSession() -> SessionState&
+    {
+        static SessionState session;
+        return session;
+    }
+
+    struct ThreadBuffer
+    {
+        ThreadEvents thread;
+
+        ThreadBuffer()
+        {
+            auto &session = GetSession();
+            const std::lock_guard lock(session.mutex);
+            thread.index = session.next_thread++;
+            thread.events.reserve(4096);
+            session.buffers.push_back(this);
+        }
+
+        // spans of a thread that ends during a session are not lost
+        ~ThreadBuffer()
+        {
+            auto &session = GetSession();
+            const std::lock_guard lock(session.mutex);
+            if (!thread.events.empty())
+            {
+                session.finished.push_back(std::move(thread));
+            }
+            std::erase(session.buffers, this);
+        }
+    };
+
+    auto Open(const std::string &path) -> void
+    {
+        auto &session = GetSession();
+        const std::lock_guard lock(session.mutex);
+        Ensure(session.path.empty(), "Trace: A session is already open");
+        Ensure(!path.empty(), "Trace: Empty path");
+
+        session.path  = path;
+        session.start = std::chrono::steady_clock::now();
+        Detail::enabled.store(true, std::memory_order_release);
+    }
+
+    auto IsOpen() -> bool
+    {
+        return Detail::enabled.load(std::memory_order_acquire);
+    }
+
+    // e.g. {"name": "reconstruct", "cat": "FlightPath", "ph": "X", "ts": 12.345, "dur": 678.901, "pid": 1, "tid": 0}
+    static auto WriteEvents(std::ofstream &file, const ThreadEvents &thread, bool &first) -> void
+    {
+        const auto separator = [&first] { const char *s = first ? "\n" : ",\n"; first = false; return s; };
+
+        file << separator() << std::format("{{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": {0}, \"args\": {{\"name\": \"thread {0}\"}}}}", thread.index);
+        for (const auto &event : thread.events)
+        {
+            file << separator() << std::format("{{\"name\": \"{}\", \"cat\": \"FlightPath\", \"ph\": \"X\", \"ts\": {:.3f}, \"dur\": {:.3f}, \"pid\": 1, \"tid\": {}}}",
+                event.name, static_cast<double>(event.begin_ns) * 1e-3, static_cast<double>(event.end_ns - event.begin_ns) * 1e-3, thread.index);
+        }
+    }
+
+    auto Close() -> void
+    {
+        auto &session = GetSession();
+        const std::lock_guard lock(session.mutex);
+        if (session.path.empty()) return;
+
+        Detail::enabled.store(false, std::memory_order_release);
+        const std::string path = std::exchange(session.path, {});
+
+        std::vector<ThreadEvents> threads = std::move(session.finished);
+        session.finished.clear();
+        for (auto *buffer : session.buffers)
+        {
+            if (!buffer->thread.events.empty())
+            {
+                threads.push_back(buffer->thread);
+                buffer->thread.events.clear();
+            }
+        }
+        std::ranges::sort(threads, {}, &ThreadEvents::index);
+
+        std::ofstream file(path);
+        Ensure(file.is_open(), "Trace: Could not open file {}", path);
+
+        file << "{\"traceEvents\": [";
+        bool first = true;
+        for (const auto &thread : threads)
+        {
+            WriteEvents(file, thread, first);
+        }
+        file << "\n], \"displayTimeUnit\": \"ms\"}\n";
+
+        file.close();
+        Ensure(!file.fail(), "Trace: Could not write file {}", path);
+    }
+
+    Session::Session(const std::string &path)
+    {
+        Open(path);
+        open_ = true;
+    }
+
+    Session::~Session()
+    {
+        // a destructor must not throw, e.g. while an exception unwinds the scope
+        try
+        {
+            Close();
+        }
+        catch (const Exception&)
+        {
+        }
+    }
+
+    auto Session::Close() -> void
+    {
+        if (!std::exchange(open_, false)) return;
+        Trace::Close();
+    }
+
+    namespace Detail
+    {
+        auto Now() -> uint64_t
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - GetSession().start;
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+        auto Record(const char *name, const uint64_t begin_ns, const uint64_t end_ns) -> void
+        {
+            // a span that began in a session which is closed by now
+            if (!enabled.load(std::memory_order_relaxed)) return;
+
+            // allocated on first use, so threads that never record do not pay for a buffer
+            thread_local std::unique_ptr<ThreadBuffer> buffer;
+            if (!buffer)
+            {
+                buffer = std::make_unique<ThreadBuffer>();
+            }
+            buffer->thread.events.push_back(Event{.name = name, .begin_ns = begin_ns, .end_ns = end_ns});
+        }
+    }
+}
@@ -0,0 +1,90 @@
+#include "TrajectoryStore.hpp"
+
+#include <atomic>
+#include <bit>
+
+#include "Error.hpp"
+
+namespace FlightPath
+{
+    // the row count is shared between processes, which requires a lock-free (address-free) atomic
+    static_assert(std::atomic_ref<uint64_t>::is_always_lock_free, "TrajectoryStore: 64 bit atomics are not lock-free");
+
+    // atomic access to the row count in the mapped header
+    // note: the reader's mapping is read-only, an atomic load never writes, so casting away const is safe
+    static auto RowCount(const Columnar::Header &header) -> std::atomic_ref<uint64_t>
+    {
+        return std::atomic_ref<uint64_t>(const_cast<uint64_t&>(header.row_count));
+    }
+
+    TrajectoryStore::TrajectoryStore(const std::string &path, const uint64_t capacity)
+        : file_(path, Columnar::GetEntryFileSize(capacity))
+        , capacity_(capacity)
+    {
+        Ensure(std::endian::native == std::endian::little, "TrajectoryStore: Requires a little-endian host");
+
+        const auto data = file_.GetData();
+        Columnar::InitializeEntryFile(data, capacity);
+
+        const auto fields = Columnar::GetEntryFields();
+        Ensure(fields.size() == columns_.size(), "TrajectoryStore: Unexpected number of columns {}", fields.size());
+        for (size_t c = 0; c < fields.size(); ++c)
+        {
+            columns_[c] = const_cast<double*>(Columnar::FindColumn(data, fields[c].name));
+        }
+    }
+
+    auto TrajectoryStore::Append(const Entry &entry) -> void
+    {
+        Ensure(size_ < capacity_, "TrajectoryStore: Store is full ({} entries)", capacity_);
+
+        const auto fields = Columnar::GetEntryFields();
+        for (size_t c = 0; c < fields.size(); ++c)
+        {
+            columns_[c][size_] = entry.*fields[c].member;
+        }
+
+        // the values above happen before the new count in every reader that acquires it
+        ++size_;
+        RowCount(*reinterpret_cast<const Columnar::Header*>(file_.GetData().data())).store(size_, std::memory_order_release);
+    }
+
+    TrajectoryView::TrajectoryView(const std::string &path)
+        : file_(path)
+    {
+        Ensure(std::endian::native == std::endian::little, "TrajectoryView: Requires a little-endian host");
+        const auto data = file_.GetData();
+        Columnar::Validate(data);
+
+        // looked up once, GetEntry reads every column
+        const auto fields = Columnar::GetEntryFields();
+        Ensure(fields.size() == columns_.size(), "TrajectoryView: Unexpected number of columns {}", fields.size());
+        for (size_t c = 0; c < fields.size(); ++c)
+        {
+            columns_[c] = Columnar::FindColumn(data, fields[c].name);
+        }
+    }
+
+    auto TrajectoryView::GetSize() const -> uint64_t
+    {
+        return RowCount(GetHeader()).load(std::memory_order_acquire);
+    }
+
+    auto TrajectoryView::GetColumn(const std::string_view name) const -> std::span<const double>
+    {
+        return {Columnar::FindColumn(file_.GetData(), name), GetSize()};
+    }
+
+    auto TrajectoryView::GetEntry(const uint64_t index) const -> Entry
+    {
+        Ensure(index < GetSize(), "TrajectoryView: Entry {} is not published yet", index);
+
+        const auto fields = Columnar::GetEntryFields();
+        Entry entry{};
+        for (size_t c = 0; c < fields.size(); ++c)
+        {
+            entry.*fields[c].member = columns_[c][index];
+        }
+        return entry;
+    }
+}
@@ -0,0 +1,67 @@
+#include "AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+    #include <malloc.h>
+#endif
+
+// replacements of the global allocation functions, the array and nothrow forms forward to these
+// note: plain counters of the calling thread, a thread_local of trivial type needs no allocation itself
+
+static thread_local AllocationStats stats;
+
+auto GetAllocationStats() -> AllocationStats
+{
+    return stats;
+}
+
+static auto Allocate(const std::size_t size) -> void*
+{
+    ++stats.allocations;
+    stats.bytes += size;
+    if (void *pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+    throw std::bad_alloc();
+}
+
+static auto AllocateAligned(const std::size_t size, const std::align_val_t alignment) -> void*
+{
+    ++stats.allocations;
+    stats.bytes += size;
+
+    const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+    if (void *pointer = _aligned_malloc(size == 0 ? 1 : size, align)) return pointer;
+#else
+    // aligned_alloc requires a multiple of the alignment
+    const std::size_t rounded = (size + align - 1) / align * align;
+    if (void *pointer = std::aligned_alloc(align, rounded == 0 ? align : rounded)) return pointer;
+#endif
+    throw std::bad_alloc();
+}
+
+static auto Deallocate(void *pointer) -> void
+{
+    if (pointer == nullptr) return;
+    ++stats.deallocations;
+    std::free(pointer);
+}
+
+static auto DeallocateAligned(void *pointer) -> void
+{
+    if (pointer == nullptr) return;
+    ++stats.deallocations;
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+auto operator new(std::size_t size) -> void*                                              { return Allocate(size); }
+auto operator new(std::size_t size, std::align_val_t alignment) -> void*                  { return AllocateAligned(size, alignment); }
+auto operator delete(void *pointer) noexcept -> void                                      { Deallocate(pointer); }
+auto operator delete(void *pointer, std::size_t) noexcept -> void                         { Deallocate(pointer); }
+auto operator delete(void *pointer, std::align_val_t) noexcept -> void                    { DeallocateAligned(pointer); }
+auto operator delete(void *pointer, std::size_t, std::align_val_t) noexcept -> void       { DeallocateAligned(pointer); }
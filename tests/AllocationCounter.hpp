@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Heap allocation statistics of the calling thread.
+ *
+ * Counted by the replacements of the global operator new and delete in AllocationCounter.cpp,
+ * which every test executable linking it uses. Only the calling thread is counted, so
+ * background threads (e.g. of the asynchronous log) do not disturb a measurement.
+ */
+struct AllocationStats
+{
+    uint64_t allocations   = 0; ///< Calls of operator new (all forms).
+    uint64_t deallocations = 0; ///< Calls of operator delete with a non-null pointer.
+    uint64_t bytes         = 0; ///< Bytes requested by operator new.
+};
+
+/// @brief Returns the allocation statistics of the calling thread since it started.
+auto GetAllocationStats() -> AllocationStats;
+
+/**
+ * @class AllocationCounter
+ * @brief Counts the heap allocations of the calling thread from its construction on.
+ *
+ * @code
+ * AllocationCounter counter;
+ * recorder.WriteData(position, attitude, velocity);
+ * REQUIRE(counter.GetAllocations() == 0);
+ * @endcode
+ */
+class AllocationCounter
+{
+public:
+    /// @brief Starts counting.
+    AllocationCounter() : start_(GetAllocationStats()) {}
+
+    /// @brief Returns the number of allocations since construction.
+    auto GetAllocations() const -> uint64_t { return GetAllocationStats().allocations - start_.allocations; }
+
+    /// @brief Returns the number of allocated bytes since construction.
+    auto GetBytes() const -> uint64_t { return GetAllocationStats().bytes - start_.bytes; }
+
+private:
+    AllocationStats start_; ///< Statistics at construction.
+};
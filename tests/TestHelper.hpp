@@ -2,14 +2,18 @@
 
 #include <limits>    
 
+#include <filesystem>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <streambuf>
-#include <functional>
+#include <string>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include "Application.hpp"
 #include "Vec3.hpp"
 
 /**
@@ -81,3 +85,25 @@ inline auto CaptureOutput(const std::function<void()>& log_function) -> std::str
 
     return captured_output.str();
 }
+
+/**
+ * @brief Runs the application on a flight log and removes the KML file it writes.
+ *
+ * The KML export is written to the temporary directory, tests only inspect the recorder and the
+ * reports of the returned application.
+ *
+ * @param settings   The options of the run, input_path and kml_path are replaced.
+ * @param input_path The flight log to reconstruct.
+ * @return The application after Run.
+ */
+inline auto RunApplication(FlightPath::ApplicationSettings settings,
+                           const std::string &input_path = std::string(PROJECT_ROOT_PATH) + "/data/UnitTest.txt") -> std::unique_ptr<FlightPath::Application>
+{
+    settings.input_path = input_path;
+    settings.kml_path   = (std::filesystem::temp_directory_path() / "FlightPath_test_RunApplication.kml").string();
+
+    auto application = std::make_unique<FlightPath::Application>(settings);
+    application->Run();
+    std::filesystem::remove(settings.kml_path);
+    return application;
+}
@@ -0,0 +1,220 @@
+// Performance regression test of one pipeline stage on a fixed synthetic flight.
+//
+// Usage: FlightPathPerfTests --stage parse|integrate|export --baseline <file>
+//                            [--tolerance 0.3] [--samples 200000] [--repetitions 5] [--update]
+//
+// The stage runs `repetitions` times, its median wall time is compared to the time stored in the
+// baseline file (one "<stage>/<samples> <seconds>" line per stage and sample count, e.g.
+// "parse/200000 0.412"). The test fails if the median exceeds the baseline by more than the
+// tolerance (relative). A missing entry is recorded instead and the test passes, --update replaces
+// an existing one. Baselines only make sense for the machine and build type they were recorded
+// with, so keep one file per machine and build type.
+
+#include "Application.hpp"
+#include "Error.hpp"
+#include "Recorder.hpp"
+#include "SyntheticFlight.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace FlightPath;
+
+    struct Options
+    {
+        std::string stage;
+        std::string baseline_path;
+        double      tolerance   = 0.3;
+        size_t      samples     = 200'000;
+        size_t      repetitions = 5;
+        bool        update      = false;
+    };
+
+    auto ParseOptions(const int argc, char *argv[]) -> Options
+    {
+        Options options;
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            const auto value = [&]() -> std::string
+            {
+                Ensure(i + 1 < argc, "Missing value of {}", arg);
+                return argv[++i];
+            };
+
+            if      (arg == "--stage")       options.stage         = value();
+            else if (arg == "--baseline")    options.baseline_path = value();
+            else if (arg == "--tolerance")   options.tolerance     = std::stod(value());
+            else if (arg == "--samples")     options.samples       = std::stoull(value());
+            else if (arg == "--repetitions") options.repetitions   = std::stoull(value());
+            else if (arg == "--update")      options.update        = true;
+            else throw Exception(std::format("Unknown argument {}", arg));
+        }
+
+        Ensure(options.stage == "parse" || options.stage == "integrate" || options.stage == "export", "Invalid stage '{}', use parse, integrate or export", options.stage);
+        Ensure(!options.baseline_path.empty(), "Missing --baseline");
+        Ensure(options.tolerance >= 0.0 && options.samples >= 2 && options.repetitions >= 1, "Invalid tolerance, samples or repetitions");
+        return options;
+    }
+
+    // "<stage>/<samples>" -> seconds
+    auto ReadBaseline(const std::string &path) -> std::map<std::string, double>
+    {
+        std::map<std::string, double> baseline;
+        std::ifstream file(path);
+        std::string key;
+        double seconds = 0.0;
+        while (file >> key >> seconds)
+        {
+            baseline[key] = seconds;
+        }
+        return baseline;
+    }
+
+    auto WriteBaseline(const std::string &path, const std::map<std::string, double> &baseline) -> void
+    {
+        std::ofstream file(path);
+        Ensure(file.is_open(), "Could not write baseline {}", path);
+        for (const auto &[key, seconds] : baseline)
+        {
+            file << std::format("{} {:.6f}\n", key, seconds);
+        }
+    }
+
+    // redirects standard output while it exists, also if the stage throws
+    class SilenceOutput
+    {
+    public:
+        SilenceOutput() : buffer_(std::cout.rdbuf(silenced_.rdbuf())) {}
+        ~SilenceOutput() { std::cout.rdbuf(buffer_); }
+
+        SilenceOutput(const SilenceOutput&) = delete;
+        auto operator=(const SilenceOutput&) -> SilenceOutput& = delete;
+
+    private:
+        std::ostringstream silenced_;
+        std::streambuf    *buffer_;
+    };
+
+    // median wall time of the measured part of a stage, prepare runs before every repetition and is not timed
+    auto Measure(const size_t repetitions, const std::function<void()> &prepare, const std::function<void()> &run) -> double
+    {
+        std::vector<double> seconds;
+        for (size_t r = 0; r < repetitions; ++r)
+        {
+            prepare();
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            seconds.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        std::ranges::sort(seconds);
+        return seconds[seconds.size() / 2];
+    }
+
+    auto MeasureStage(const Options &options) -> double
+    {
+        const auto directory  = std::filesystem::temp_directory_path();
+        const auto input_path = (directory / std::format("FlightPath_perf_{}.txt", options.stage)).string();
+        const auto kml_path   = (directory / std::format("FlightPath_perf_{}.kml", options.stage)).string();
+        const auto fpc_path   = (directory / std::format("FlightPath_perf_{}.fpc", options.stage)).string();
+        WriteSyntheticFlight(input_path, options.samples);
+
+        ApplicationSettings settings;
+        settings.input_path    = input_path;
+        settings.kml_path      = kml_path;
+        settings.retain_output = options.stage == "export";
+
+        std::unique_ptr<Application> application;
+        double seconds = 0.0;
+
+        if (options.stage == "parse")
+        {
+            // Recorder::ReadFile
+            seconds = Measure(options.repetitions, [] {}, [&]
+            {
+                Recorder recorder;
+                recorder.ReadFile(input_path);
+            });
+        }
+        else if (options.stage == "integrate")
+        {
+            // Application::Run, the reconstruction including the streamed KML track
+            seconds = Measure(options.repetitions, [&] { application = std::make_unique<Application>(settings); }, [&] { application->Run(); });
+        }
+        else
+        {
+            // exports of the reconstructed track
+            application = std::make_unique<Application>(settings);
+            application->Run();
+            const Recorder &recorder = application->GetRecorder();
+            seconds = Measure(options.repetitions, [] {}, [&]
+            {
+                recorder.DumpSimplifiedKML(kml_path, 5.0);
+                recorder.DumpColumnar(fpc_path);
+            });
+        }
+
+        application.reset();
+        std::filesystem::remove(input_path);
+        std::filesystem::remove(kml_path);
+        std::filesystem::remove(fpc_path);
+        return seconds;
+    }
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+    try
+    {
+        const Options options = ParseOptions(argc, argv);
+
+        // the application logs its progress, only the result of the test is of interest
+        double seconds = 0.0;
+        {
+            SilenceOutput silence;
+            seconds = MeasureStage(options);
+        }
+
+        // a time is only comparable to one of the same stage and sample count
+        const std::string key = std::format("{}/{}", options.stage, options.samples);
+        auto baseline = ReadBaseline(options.baseline_path);
+        const auto entry = baseline.find(key);
+        if (entry == baseline.end() || options.update)
+        {
+            baseline[key] = seconds;
+            WriteBaseline(options.baseline_path, baseline);
+            std::cout << std::format("{}: {:.4f} s for {} samples, recorded as baseline in {}\n", options.stage, seconds, options.samples, options.baseline_path);
+            return 0;
+        }
+
+        const double limit = entry->second * (1.0 + options.tolerance);
+        const double change = seconds / entry->second - 1.0;
+        std::cout << std::format("{}: {:.4f} s for {} samples, baseline {:.4f} s ({:+.1f} %, limit {:+.1f} %)\n",
+            options.stage, seconds, options.samples, entry->second, 100.0 * change, 100.0 * options.tolerance);
+
+        if (seconds > limit)
+        {
+            std::cout << std::format("{}: Regression, {:.4f} s exceeds the limit of {:.4f} s\n", options.stage, seconds, limit);
+            return 1;
+        }
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+}
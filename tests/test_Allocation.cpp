@@ -0,0 +1,61 @@
+#include "AllocationCounter.hpp"
+#include "KML.hpp"
+#include "KMLSink.hpp"
+#include "Reconstruction.hpp"
+#include "Recorder.hpp"
+#include "SyntheticFlight.hpp"
+
+#include <filesystem>
+#include <memory>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[Allocation] Counter sees allocations of the calling thread", "[Allocation]")
+    {
+        AllocationCounter counter;
+        auto value = std::make_unique<double>(1.0);
+        REQUIRE(counter.GetAllocations() == 1);
+        REQUIRE(counter.GetBytes() == sizeof(double));
+    }
+
+    TEST_CASE("[Allocation] Integration step does not allocate", "[Allocation]")
+    {
+        const auto input_path = std::filesystem::temp_directory_path() / "FlightPath_test_Allocation.txt";
+        const auto kml_path   = std::filesystem::temp_directory_path() / "FlightPath_test_Allocation.kml";
+        constexpr size_t samples = 20000;
+        WriteSyntheticFlight(input_path.string(), samples);
+
+        Recorder recorder;
+        recorder.ReadFile(input_path.string());
+        recorder.ReserveOutput(samples);
+        std::filesystem::remove(input_path);
+
+        const auto &data = recorder.GetData();
+        Reconstructor reconstructor(GetInitialState(data[0]));
+
+        // the reconstructed track is streamed like in Application::Run
+        KMLSink sink(kml_path.string(), 5.0);
+        sink.BeginTrack(KML::OpenReconstructedDataset);
+        sink.Push(data[0]);
+
+        // the steps of Application::Run once everything is set up, on the logged accelerations and rates
+        AllocationCounter counter;
+        for (size_t i = 0; i + 1 < samples; ++i)
+        {
+            const Entry &entry = data[i];
+            reconstructor.Step(
+                Vec3<double>(entry.a_x, entry.a_y, entry.a_z),
+                Vec3<double>(entry.omega_x, entry.omega_y, entry.omega_z),
+                data[i + 1].time - entry.time);
+            sink.Push(recorder.WriteData(reconstructor.GetPosition(), reconstructor.GetAttitude(), reconstructor.GetVelocity()));
+        }
+        REQUIRE(counter.GetAllocations() == 0);
+        REQUIRE(recorder.GetOutputData().size() == samples);
+
+        sink.EndTrack();
+        sink.Close();
+        std::filesystem::remove(kml_path);
+    }
+}
@@ -0,0 +1,107 @@
+#include "BinaryLog.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    // removes the thread label (e.g. "T0 ") of every decoded line and collects the labels,
+    // the number of a thread depends on the threads that recorded before (e.g. in other tests)
+    static auto StripThreadLabels(const std::string &text, std::set<std::string> &labels) -> std::string
+    {
+        std::istringstream lines(text);
+        std::string stripped;
+        for (std::string line; std::getline(lines, line);)
+        {
+            const size_t space = line.find(' ');
+            labels.insert(line.substr(0, space));
+            stripped += line.substr(space + 1) + "\n";
+        }
+        return stripped;
+    }
+
+    TEST_CASE("[BinaryLog] Records are decoded as text and CSV", "[BinaryLog]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_BinaryLog.fpbl";
+
+        // nothing is recorded without a session
+        BinaryLog::Write<"ignored {}">(1);
+
+        BinaryLog::Open(path.string());
+        REQUIRE_THROWS(BinaryLog::Open(path.string()));
+
+        BinaryLog::Write<"dt={:.3f} step={} ok={}">(0.0125, 42, true);
+        BinaryLog::Write<"{{literal}} {:>5}|{}">(-7, uint8_t(200));
+        BinaryLog::Write<"no arguments">();
+        BinaryLog::Close();
+
+        std::ostringstream text;
+        REQUIRE(BinaryLog::Decode(path.string(), text, BinaryLog::Output::Text) == 3);
+        std::set<std::string> labels;
+        REQUIRE(StripThreadLabels(text.str(), labels) == "dt=0.013 step=42 ok=true\n{literal}    -7|200\nno arguments\n");
+        REQUIRE(labels.size() == 1);
+
+        std::ostringstream csv;
+        REQUIRE(BinaryLog::Decode(path.string(), csv, BinaryLog::Output::CSV) == 3);
+        // format ids are assigned once per call site and process, so only the other columns are compared
+        const std::string rows = csv.str();
+        REQUIRE(rows.starts_with("thread,format_id,format,values\n"));
+        REQUIRE(rows.find(",\"dt={:.3f} step={} ok={}\",0.0125,42,true\n") != std::string::npos);
+        REQUIRE(rows.find(",\"{{literal}} {:>5}|{}\",-7,200\n") != std::string::npos);
+        REQUIRE(rows.ends_with(",\"no arguments\"\n"));
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("[BinaryLog] Buffers of all threads are written", "[BinaryLog]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_BinaryLog_threads.fpbl";
+        constexpr int thread_count = 3;
+        constexpr int record_count = 10000; // more than one buffer per thread
+
+        BinaryLog::Open(path.string());
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back([]
+            {
+                for (int i = 0; i < record_count; ++i)
+                {
+                    BinaryLog::Write<"{} {} {}">(i, 0.5 * i, i % 2 == 0);
+                }
+            });
+        }
+        for (auto &thread : threads) thread.join();
+        BinaryLog::Write<"main">();
+        BinaryLog::Close();
+
+        std::ostringstream text;
+        REQUIRE(BinaryLog::Decode(path.string(), text, BinaryLog::Output::Text) == thread_count * record_count + 1);
+        REQUIRE(text.str().find(" 9999 4999.5 false\n") != std::string::npos);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("[BinaryLog] Rejects invalid files", "[BinaryLog]")
+    {
+        std::ostringstream output;
+        REQUIRE_THROWS(BinaryLog::Decode("this/file/does/not/exist.fpbl", output, BinaryLog::Output::Text));
+        REQUIRE_THROWS(BinaryLog::Decode(std::string(PROJECT_ROOT_PATH) + "/data/UnitTest.txt", output, BinaryLog::Output::Text));
+
+        // truncated records
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_BinaryLog_truncated.fpbl";
+        BinaryLog::Open(path.string());
+        BinaryLog::Write<"{}">(1.0);
+        BinaryLog::Close();
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+        REQUIRE_THROWS(BinaryLog::Decode(path.string(), output, BinaryLog::Output::Text));
+        std::filesystem::remove(path);
+    }
+}
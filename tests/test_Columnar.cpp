@@ -0,0 +1,133 @@
+#include "Columnar.hpp"
+#include "Error.hpp"
+#include "TestHelper.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[Columnar] Write and read back", "[Columnar]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_Columnar.fpc";
+
+        Recorder recorder;
+        recorder.ReadFile(std::string(PROJECT_ROOT_PATH) + "/data/UnitTest.txt");
+        recorder.WriteData(
+            FlightPath::Position{15.76_deg, 42.9_deg, 3658.4_m},
+            FlightPath::Attitude{180.1_deg, 0.3_deg, -0.5_deg},
+            FlightPath::Vec3{.x=171.0, .y=-1.3, .z=0.5}
+        );
+        recorder.DumpColumnar(path.string());
+
+        const Columnar::Reader reader(path.string());
+        const auto &header = reader.GetHeader();
+        REQUIRE(header.row_count == 2);
+        REQUIRE(header.column_count == Columnar::GetEntryFields().size());
+        REQUIRE(std::filesystem::file_size(path) == header.file_size);
+
+        // every column is aligned for SIMD loads and memory mapping
+        for (const auto &column : reader.GetSchema())
+        {
+            REQUIRE(column.offset % Columnar::Alignment == 0);
+        }
+        REQUIRE(std::string(reader.GetSchema()[3].name.data()) == "altitude");
+        REQUIRE(std::string(reader.GetSchema()[3].unit.data()) == "m");
+
+        const auto altitude = reader.GetColumn("altitude");
+        REQUIRE(reinterpret_cast<std::uintptr_t>(altitude.data()) % Columnar::Alignment == 0);
+        CheckReal<double>(altitude[0], 3657.4);
+        CheckReal<double>(altitude[1], 3658.4);
+
+        const auto entries = reader.GetEntries();
+        const auto &expected = recorder.GetOutputData();
+        REQUIRE(entries.size() == expected.size());
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            for (const auto &field : Columnar::GetEntryFields())
+            {
+                REQUIRE(entries[i].*field.member == expected[i].*field.member);
+            }
+        }
+
+        REQUIRE_THROWS(reader.GetColumn("unknown"));
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("[Columnar] Rejects invalid files", "[Columnar]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_Columnar_invalid.fpc";
+
+        {
+            std::ofstream file(path, std::ios::binary);
+            file << "not a columnar file, but long enough to hold a header ............................";
+        }
+        REQUIRE_THROWS(Columnar::Reader(path.string()));
+
+        // truncated file
+        Columnar::Write(path.string(), std::vector<Entry>(100));
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+        REQUIRE_THROWS(Columnar::Reader(path.string()));
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("[Columnar] Rejects header fields that wrap the bounds checks", "[Columnar]")
+    {
+        constexpr uint64_t capacity = 16;
+        std::vector<std::byte, AlignedAllocator<std::byte, Columnar::Alignment>> data(Columnar::GetEntryFileSize(capacity));
+
+        // a valid file with one modification of its header or first column
+        const auto craft = [&data](const std::function<void(Columnar::Header&, Columnar::ColumnDescriptor&)> &modify)
+        {
+            std::fill(data.begin(), data.end(), std::byte{0});
+            Columnar::InitializeEntryFile(data, capacity);
+            auto &header = *reinterpret_cast<Columnar::Header*>(data.data());
+            modify(header, *reinterpret_cast<Columnar::ColumnDescriptor*>(data.data() + header.schema_offset));
+        };
+
+        craft([](Columnar::Header&, Columnar::ColumnDescriptor&) {});
+        REQUIRE_NOTHROW(Columnar::Validate(data));
+
+        // capacity * sizeof(double) wraps to 8
+        craft([](Columnar::Header &header, Columnar::ColumnDescriptor&) { header.capacity = (uint64_t(1) << 61) + 1; });
+        REQUIRE_THROWS_AS(Columnar::Validate(data), Exception);
+
+        // schema_offset + column_count * sizeof(ColumnDescriptor) wraps to 0
+        craft([](Columnar::Header &header, Columnar::ColumnDescriptor&)
+        {
+            header.schema_offset = std::numeric_limits<uint64_t>::max() - sizeof(Columnar::ColumnDescriptor) + 1;
+            header.column_count  = 1;
+        });
+        REQUIRE_THROWS_AS(Columnar::Validate(data), Exception);
+
+        craft([](Columnar::Header &header, Columnar::ColumnDescriptor&) { header.column_count = std::numeric_limits<uint32_t>::max(); });
+        REQUIRE_THROWS_AS(Columnar::Validate(data), Exception);
+
+        // schema inside the header or misaligned
+        craft([](Columnar::Header &header, Columnar::ColumnDescriptor&) { header.schema_offset = 0; });
+        REQUIRE_THROWS_AS(Columnar::Validate(data), Exception);
+        craft([](Columnar::Header &header, Columnar::ColumnDescriptor&) { header.schema_offset += 8; });
+        REQUIRE_THROWS_AS(Columnar::Validate(data), Exception);
+
+        // column offset past the end of the file
+        craft([](Columnar::Header&, Columnar::ColumnDescriptor &column) { column.offset = std::numeric_limits<uint64_t>::max() - 63; });
+        REQUIRE_THROWS_AS(Columnar::Validate(data), Exception);
+
+        // the reader validates before it touches a column
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_Columnar_crafted.fpc";
+        craft([](Columnar::Header &header, Columnar::ColumnDescriptor&) { header.capacity = (uint64_t(1) << 61) + 1; });
+        {
+            std::ofstream file(path, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        }
+        REQUIRE_THROWS_AS(Columnar::Reader(path.string()), Exception);
+        std::filesystem::remove(path);
+    }
+}
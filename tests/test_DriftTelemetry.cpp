@@ -0,0 +1,102 @@
+#include "DriftTelemetry.hpp"
+#include "Error.hpp"
+#include "TestHelper.hpp"
+
+#include <sstream>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[DriftTelemetry] Histogram bins", "[DriftTelemetry]")
+    {
+        // [1e-3, 1e-2), [1e-2, 1e-1), [1e-1, 1) plus underflow and overflow
+        LogHistogram histogram(1e-3, 1.0, 1);
+        REQUIRE(histogram.GetCounts().size() == 5);
+
+        histogram.Add(0.0);
+        histogram.Add(1e-4);
+        histogram.Add(5e-3);
+        histogram.Add(5e-2);
+        histogram.Add(5e-2);
+        histogram.Add(0.5);
+        histogram.Add(20.0);
+
+        const auto &counts = histogram.GetCounts();
+        REQUIRE(counts[0] == 2);
+        REQUIRE(counts[1] == 1);
+        REQUIRE(counts[2] == 2);
+        REQUIRE(counts[3] == 1);
+        REQUIRE(counts[4] == 1);
+        REQUIRE(histogram.GetTotal() == 7);
+
+        REQUIRE(histogram.GetLowerBound(0) == 0.0);
+        REQUIRE_THAT(histogram.GetLowerBound(1), Catch::Matchers::WithinRel(1e-3, 1e-12));
+        REQUIRE_THAT(histogram.GetLowerBound(4), Catch::Matchers::WithinRel(1.0, 1e-12));
+
+        // the 4th and 5th of 7 values fall into [1e-2, 1e-1)
+        REQUIRE_THAT(histogram.GetPercentile(50.0), Catch::Matchers::WithinRel(1e-1, 1e-12));
+
+        REQUIRE_THROWS_AS(LogHistogram(0.0, 1.0, 1), Exception);
+        REQUIRE_THROWS_AS(LogHistogram(1.0, 1.0, 1), Exception);
+    }
+
+    TEST_CASE("[DriftTelemetry] Sampling interval", "[DriftTelemetry]")
+    {
+        REQUIRE_THROWS_AS(DriftTelemetry(0), Exception);
+
+        DriftTelemetry telemetry(4);
+        size_t sampled = 0;
+        for (size_t step = 0; step < 10; ++step)
+        {
+            if (telemetry.ShouldSample())
+            {
+                // steps 0, 4 and 8
+                REQUIRE(step % 4 == 0);
+                telemetry.Add({.orthogonal_error = 1e-16 * static_cast<double>(step + 1), .length_error = 0.0, .dt = 0.1, .divergence = 2.0});
+                ++sampled;
+            }
+            telemetry.AddIterations(step < 5 ? 1 : 2);
+        }
+
+        REQUIRE(sampled == 3);
+        REQUIRE(telemetry.GetSamples() == 3);
+        REQUIRE(telemetry.GetSteps() == 10);
+        REQUIRE(telemetry.GetIterations()[1] == 5);
+        REQUIRE(telemetry.GetIterations()[2] == 5);
+        REQUIRE(telemetry.GetMeanIterations() == 1.5);
+
+        const auto &orthogonal_error = telemetry.GetOrthogonalError();
+        REQUIRE(orthogonal_error.min == 1e-16);
+        REQUIRE(orthogonal_error.max == 9e-16);
+        REQUIRE_THAT(orthogonal_error.GetMean(), Catch::Matchers::WithinRel(5e-16, 1e-12));
+        REQUIRE(telemetry.GetDivergence().GetMean() == 2.0);
+        REQUIRE(telemetry.GetLengthError().histogram.GetCounts()[0] == 3);
+    }
+
+    TEST_CASE("[DriftTelemetry] Application samples the reconstruction", "[DriftTelemetry]")
+    {
+        ApplicationSettings settings;
+        settings.drift_sample_interval = 10;
+        const auto application = RunApplication(settings);
+
+        const auto steps = application->GetRecorder().GetData().size() - 1;
+        const auto &telemetry = application->GetDriftTelemetry();
+        REQUIRE(telemetry.has_value());
+        REQUIRE(telemetry->GetSteps() == steps);
+        REQUIRE(telemetry->GetSamples() == (steps + 9) / 10);
+
+        // the transform drifts a little every step and is corrected again
+        REQUIRE(telemetry->GetMeanIterations() >= 1.0);
+        REQUIRE(telemetry->GetOrthogonalError().max < 1e-6);
+        REQUIRE(telemetry->GetTimeStep().min > 0.0);
+        REQUIRE(telemetry->GetDivergence().min >= 0.0);
+
+        std::stringstream summary;
+        telemetry->WriteSummary(summary);
+        REQUIRE_THAT(summary.str(), Catch::Matchers::ContainsSubstring("orthogonal error"));
+        REQUIRE_THAT(summary.str(), Catch::Matchers::ContainsSubstring("divergence [m]"));
+    }
+}
@@ -0,0 +1,63 @@
+#include "KMLLod.hpp"
+#include "TestHelper.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+namespace FlightPath
+{
+    static auto ReadLodFile(const std::filesystem::path &path) -> std::string
+    {
+        std::ifstream file(path);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    TEST_CASE("[KMLLod] Tiles, regions and time stamps", "[KMLLod]")
+    {
+        using namespace std::chrono;
+        const auto directory = std::filesystem::temp_directory_path() / "FlightPath_test_KMLLod";
+        std::filesystem::remove_all(directory);
+
+        // straight northbound track with 10 entries
+        std::vector<Entry> entries(10);
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            entries[i].time      = 3600.0 + 0.5 * static_cast<double>(i);
+            entries[i].longitude = 15.0_deg;
+            entries[i].latitude  = deg2rad<double>(47.0 + 0.001 * static_cast<double>(i));
+            entries[i].altitude  = 1000.0;
+        }
+
+        LodSettings settings;
+        settings.tile_size  = 4;
+        settings.start_time = sys_days{2024y/March/1};
+        ExportLodKML(directory.string(), entries, std::span<const Entry>(entries).first(2), settings);
+
+        // 10 entries -> tiles [0..4], [4..8], [8..9]; 2 entries -> one tile; 2 levels each
+        size_t tile_files = 0;
+        for ([[maybe_unused]] const auto &file : std::filesystem::directory_iterator(directory / "tiles")) ++tile_files;
+        REQUIRE(tile_files == (3 + 1) * 2);
+
+        const auto doc = ReadLodFile(directory / "doc.kml");
+        REQUIRE_THAT(doc, Catch::Matchers::ContainsSubstring("<href>tiles/original_0002_1.kml</href>"));
+        REQUIRE_THAT(doc, Catch::Matchers::ContainsSubstring("<href>tiles/reconstructed_0000_0.kml</href>"));
+        REQUIRE_THAT(doc, Catch::Matchers::ContainsSubstring("<maxLodPixels>512</maxLodPixels>"));
+        REQUIRE_THAT(doc, !Catch::Matchers::ContainsSubstring("<east>15.000000000</east>"));
+
+        // the straight tile is reduced to its end points, which overlap with the next tile
+        const auto tile = ReadLodFile(directory / "tiles" / "original_0001_1.kml");
+        REQUIRE_THAT(tile, Catch::Matchers::ContainsSubstring("xmlns:gx="));
+        REQUIRE_THAT(tile, Catch::Matchers::ContainsSubstring("<when>2024-03-01T01:00:02.000Z</when>\n        <when>2024-03-01T01:00:04.000Z</when>\n        <gx:coord>"));
+        REQUIRE_THAT(tile, Catch::Matchers::ContainsSubstring("<gx:coord>15.000000000 47.008000000 1000.0</gx:coord>\n    </gx:Track>"));
+
+        settings.tile_size = 0;
+        REQUIRE_THROWS(ExportLodKML(directory.string(), entries, entries, settings));
+        std::filesystem::remove_all(directory);
+    }
+}
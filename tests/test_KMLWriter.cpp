@@ -0,0 +1,108 @@
+#include "KMLSink.hpp"
+#include "KMLWriter.hpp"
+#include "KML.hpp"
+#include "Recorder.hpp"
+#include "TestHelper.hpp"
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+namespace FlightPath
+{
+    static auto ReadText(const std::filesystem::path &path) -> std::string
+    {
+        std::ifstream file(path);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    TEST_CASE("[KMLWriter] Coordinates match std::format", "[KMLWriter]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_KMLWriter.kml";
+
+        const double values[][3] = {
+            {  15.755530969,   42.900372544,  3657.4 },
+            {  -0.0000000004,   0.0000000005,   -0.05 },
+            {-179.999999999,  -89.9999999995, 12345.66 },
+            {   1.23456789e7,   1e-12,          123456789.0 },
+        };
+
+        std::string expected = KML::Header;
+        {
+            // tiny buffer to exercise flushing between lines
+            KMLWriter writer(path.string(), 1);
+            writer.Write(KML::Header);
+            for (int repeat = 0; repeat < 10; ++repeat)
+            {
+                for (const auto &v : values)
+                {
+                    writer.WriteCoordinate(v[0], v[1], v[2]);
+                    expected += "            " + std::format("{:12.9f}, {:12.9f}, {:6.1f}\n", v[0], v[1], v[2]);
+                }
+            }
+        }
+
+        REQUIRE(ReadText(path) == expected);
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("[KMLWriter] Recorder exports every stride-th entry", "[KMLWriter]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_Recorder.kml";
+
+        Recorder recorder;
+        recorder.ReadFile(std::string(PROJECT_ROOT_PATH) + "/data/UnitTest.txt");
+
+        recorder.DumpKML(path.string(), 1);
+        const auto full = ReadText(path);
+        REQUIRE_THAT(full, Catch::Matchers::ContainsSubstring("15.755530969, 42.900372544, 3657.4\n"));
+        REQUIRE_THAT(full, Catch::Matchers::ContainsSubstring("15.755531608, 42.900354289, 3657.4\n"));
+
+        recorder.DumpKML(path.string());
+        const auto strided = ReadText(path);
+        REQUIRE_THAT(strided, Catch::Matchers::ContainsSubstring("15.755530969, 42.900372544, 3657.4\n"));
+        REQUIRE_THAT(strided, !Catch::Matchers::ContainsSubstring("15.755531608"));
+
+        REQUIRE_THROWS(recorder.DumpKML(path.string(), 0));
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("[KMLWriter] Streamed export without retained output", "[KMLWriter]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_KMLSink.kml";
+
+        Recorder recorder;
+        recorder.SetRetainOutput(false);
+        recorder.ReadFile(std::string(PROJECT_ROOT_PATH) + "/data/UnitTest.txt");
+        REQUIRE_THROWS(recorder.SetRetainOutput(true));
+        const auto &data = recorder.GetData();
+
+        {
+            KMLSink sink(path.string(), 1.0);
+            sink.WriteTrack(KML::OpenOriginalDataset, data);
+            sink.BeginTrack(KML::OpenReconstructedDataset);
+            sink.Push(data[0]);
+            sink.Push(recorder.WriteData(
+                FlightPath::Position{15.76_deg, 42.9_deg, 3658.4_m},
+                FlightPath::Attitude{180.1_deg, 0.3_deg, -0.5_deg},
+                FlightPath::Vec3{.x=171.0, .y=-1.3, .z=0.5}
+            ));
+            sink.EndTrack();
+            sink.Close();
+        }
+
+        REQUIRE(recorder.GetOutputData().empty());
+
+        const auto kml = ReadText(path);
+        REQUIRE_THAT(kml, Catch::Matchers::ContainsSubstring("15.755531608, 42.900354289, 3657.4\n"));
+        REQUIRE_THAT(kml, Catch::Matchers::ContainsSubstring("15.760000000, 42.900000000, 3658.4\n"));
+        REQUIRE_THAT(kml, Catch::Matchers::EndsWith(KML::Footer));
+        std::filesystem::remove(path);
+    }
+}
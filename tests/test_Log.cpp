@@ -29,3 +29,15 @@ TEST_CASE("[Log] Error works", "[Log]")
     auto console_output = CaptureOutput([](){FlightPath::Log::Error("Error");});
     REQUIRE(console_output == "\x1B[91m[E]\x1B[0m test_Log.cpp:29 Error\n");
 }
+
+TEST_CASE("[Log] Formatting overloads", "[Log]")
+{
+    auto console_output = CaptureOutput([](){FlightPath::Log::Warn("{} of {:.1f}", 3, 4.5);});
+    REQUIRE(console_output == "\x1B[93m[W]\x1B[0m test_Log.cpp:35 3 of 4.5\n");
+
+    console_output = CaptureOutput([](){FlightPath::Log::Info("{}", "Info");});
+    REQUIRE(console_output == "\x1B[92m[I]\x1B[0m Info\n");
+
+    console_output = CaptureOutput([](){FlightPath::Log::Debug("{}", 42);});
+    REQUIRE(console_output == "\x1B[94m[D]\x1B[0m test_Log.cpp:41 42\n");
+}
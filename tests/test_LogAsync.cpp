@@ -0,0 +1,83 @@
+#include "Log.hpp"
+
+#include "TestHelper.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("[Log] Async backend keeps format and order", "[Log]")
+{
+    FlightPath::Log::EnableAsync();
+    REQUIRE(FlightPath::Log::IsAsync());
+
+    auto console_output = CaptureOutput([]()
+    {
+        FlightPath::Log::Info("Info");
+        FlightPath::Log::Warn("Warn");
+        FlightPath::Log::Flush();
+    });
+    REQUIRE(console_output == "\x1B[92m[I]\x1B[0m Info\n\x1B[93m[W]\x1B[0m test_LogAsync.cpp:19 Warn\n");
+
+    FlightPath::Log::EnableAsync(false);
+    REQUIRE_FALSE(FlightPath::Log::IsAsync());
+}
+
+TEST_CASE("[Log] Async backend accepts messages from many threads", "[Log]")
+{
+    constexpr size_t thread_count = 4;
+    constexpr size_t message_count = 2000;
+
+    FlightPath::Log::EnableAsync();
+    auto console_output = CaptureOutput([]()
+    {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back([t]
+            {
+                for (size_t i = 0; i < message_count; ++i)
+                {
+                    FlightPath::Log::Info(std::format("{} {}", t, i));
+                }
+            });
+        }
+        for (auto &thread : threads) thread.join();
+
+        // disabling writes all pending messages
+        FlightPath::Log::EnableAsync(false);
+    });
+
+    REQUIRE(static_cast<size_t>(std::count(console_output.begin(), console_output.end(), '\n')) == thread_count * message_count);
+
+    // the messages of one thread keep their order
+    for (size_t t = 0; t < thread_count; ++t)
+    {
+        size_t previous = 0;
+        for (size_t i = 0; i < message_count; i += 100)
+        {
+            const size_t position = console_output.find(std::format("[I]\x1B[0m {} {}\n", t, i));
+            REQUIRE(position != std::string::npos);
+            REQUIRE(position >= previous);
+            previous = position;
+        }
+    }
+}
+
+TEST_CASE("[Log] Async backend truncates long messages", "[Log]")
+{
+    const std::string long_message(2 * FlightPath::Log::MaxAsyncMessageLength, 'x');
+
+    FlightPath::Log::EnableAsync();
+    auto console_output = CaptureOutput([&long_message]()
+    {
+        FlightPath::Log::Info(long_message);
+        FlightPath::Log::Flush();
+    });
+    FlightPath::Log::EnableAsync(false);
+
+    REQUIRE(console_output.ends_with("...\n"));
+    REQUIRE(console_output.size() < FlightPath::Log::MaxAsyncMessageLength + 32);
+}
@@ -76,4 +76,98 @@ namespace FlightPath
             REQUIRE_THAT(value, Catch::Matchers::WithinRel(expected_value, std::numeric_limits<TestType>::epsilon() * TestType(100)));
         }
     }
+
+    TEMPLATE_TEST_CASE("[Mat4] Element-wise expression", "[Mat4]", float, double)
+    {
+        const Mat4<TestType> eye({
+            TestType(1.0), TestType(0.0), TestType(0.0), TestType(0.0),
+            TestType(0.0), TestType(1.0), TestType(0.0), TestType(0.0),
+            TestType(0.0), TestType(0.0), TestType(1.0), TestType(0.0),
+            TestType(0.0), TestType(0.0), TestType(0.0), TestType(1.0),
+        });
+
+        Mat4<TestType> A({
+            TestType( 1.0), TestType( 2.0), TestType( 3.0), TestType( 4.0),
+            TestType( 5.0), TestType( 6.0), TestType( 7.0), TestType( 8.0),
+            TestType( 9.0), TestType(10.0), TestType(11.0), TestType(12.0),
+            TestType(13.0), TestType(14.0), TestType(15.0), TestType(16.0),
+        });
+
+        const Mat4<TestType> B = eye + A * TestType(0.5) - TestType(2.0) * eye;
+
+        for (size_t row = 0; row < B.rows(); ++row)
+        for (size_t col = 0; col < B.cols(); ++col)
+        {
+            const auto expected_value = A(row, col) * TestType(0.5) - (row == col ? TestType(1.0) : TestType(0.0));
+            REQUIRE_THAT(B(row, col), Catch::Matchers::WithinRel(expected_value, std::numeric_limits<TestType>::epsilon()));
+        }
+
+        // the matrix may appear on both sides of an assignment
+        A = A - eye * TestType(1.0);
+        REQUIRE_THAT(A(0, 0), Catch::Matchers::WithinRel(TestType( 0.0), std::numeric_limits<TestType>::epsilon()));
+        REQUIRE_THAT(A(0, 1), Catch::Matchers::WithinRel(TestType( 2.0), std::numeric_limits<TestType>::epsilon()));
+        REQUIRE_THAT(A(3, 3), Catch::Matchers::WithinRel(TestType(15.0), std::numeric_limits<TestType>::epsilon()));
+    }
+
+    TEMPLATE_TEST_CASE("[Mat4] Product of expressions", "[Mat4]", float, double)
+    {
+        const Mat4<TestType> A({
+            TestType( 1.0), TestType( 2.0), TestType( 3.0), TestType( 4.0),
+            TestType( 5.0), TestType( 6.0), TestType( 7.0), TestType( 8.0),
+            TestType( 9.0), TestType(10.0), TestType(11.0), TestType(12.0),
+            TestType(13.0), TestType(14.0), TestType(15.0), TestType(16.0),
+        });
+
+        const Mat4<TestType> B = A * TestType(0.5);
+        const Mat4<TestType> sum = A + B;
+        const Mat4<TestType> expected = sum * A;
+
+        const Mat4<TestType> products[] = {(A + B) * A, sum * (A + A * TestType(0.0)), (A + B) * (A - B + B), (A + B).Evaluate() * A};
+        for (const Mat4<TestType> &product : products)
+        for (size_t row = 0; row < product.rows(); ++row)
+        for (size_t col = 0; col < product.cols(); ++col)
+        {
+            REQUIRE_THAT(product(row, col), Catch::Matchers::WithinRel(expected(row, col), std::numeric_limits<TestType>::epsilon() * TestType(100)));
+        }
+
+        // evaluated at compile time like products of matrices
+        constexpr Mat4<double> C({
+            1.0, 0.0, 0.0, 2.0,
+            0.0, 1.0, 0.0, 0.0,
+            0.0, 0.0, 1.0, 0.0,
+            0.0, 0.0, 0.0, 1.0,
+        });
+        static_assert(((C + C) * C)(0, 3) == 8.0);
+    }
+
+    TEST_CASE("[Mat4] Compile time construction and arithmetic", "[Mat4]")
+    {
+        constexpr Mat4<double> eye{
+            1.0, 0.0, 0.0, 0.0,
+            0.0, 1.0, 0.0, 0.0,
+            0.0, 0.0, 1.0, 0.0,
+            0.0, 0.0, 0.0, 1.0
+        };
+
+        constexpr Mat4<double> A({
+             1.0,  2.0,  3.0,  4.0,
+             5.0,  6.0,  7.0,  8.0,
+             9.0, 10.0, 11.0, 12.0,
+            13.0, 14.0, 15.0, 16.0
+        });
+
+        constexpr Mat4<double> B = eye + A * 2.0;
+        constexpr Mat4<double> C = A * eye;
+
+        static_assert(B(0, 0) ==  3.0 && B(0, 1) ==  4.0 && B(3, 3) == 33.0);
+        static_assert(C(1, 2) ==  7.0 && C(3, 0) == 13.0);
+        static_assert(A.GetColumn(1).Dot(Vec3<double>{.x=1.0, .y=1.0, .z=1.0}) == 18.0);
+
+        // the number of values is checked at compile time
+        static_assert( std::is_constructible_v<Mat4<double>, const double (&)[16]>);
+        static_assert(!std::is_constructible_v<Mat4<double>, const double (&)[15]>);
+        static_assert(!std::is_constructible_v<Mat4<double>, double, double, double>);
+
+        REQUIRE(B(2, 1) == 20.0);
+    }
 }
@@ -0,0 +1,60 @@
+#include "Mat4Kernels.hpp"
+#include "Mat4.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <limits>
+
+namespace FlightPath
+{
+    TEST_CASE("[Mat4Kernels] Detected level is supported", "[Mat4Kernels]")
+    {
+        REQUIRE(Kernels::IsSupported(Kernels::SimdLevel::Scalar));
+        REQUIRE(Kernels::IsSupported(Kernels::GetSimdLevel()));
+        REQUIRE(Kernels::GetSimdLevel() <= Kernels::DetectSimdLevel());
+        REQUIRE(Kernels::ToString(Kernels::SimdLevel::AVX2) == "AVX2");
+    }
+
+    TEMPLATE_TEST_CASE("[Mat4Kernels] All supported kernels match scalar kernel", "[Mat4Kernels]", float, double)
+    {
+        const Mat4<TestType> A({
+            TestType(  4.2543255324080747), TestType(35.3988720463896414), TestType(  4.3986877044241481), TestType(-31.6435228050765005),
+            TestType(-98.6444501511946470), TestType(74.1474575110778176), TestType(-31.9339915742543781), TestType(-89.6116840316522314),
+            TestType( -7.5112442746066819), TestType(-7.8281338688930049), TestType( 99.6781928366176828), TestType(-20.1687457333878086),
+            TestType(-59.6783127286815400), TestType(97.6550060192435865), TestType( 71.9255054120984880), TestType(-86.9865247458301241),
+        });
+
+        const Mat4<TestType> B({
+            TestType(-63.9409923465784829), TestType(-43.9846358181276855), TestType(-51.8463719869277853), TestType(-23.7986330792180780),
+            TestType( 69.7866280656346873), TestType(-12.1271148721767048), TestType( 45.0584897523513064), TestType(-36.8386645187420285),
+            TestType( -7.0778761064568272), TestType(-76.9999489584365193), TestType( 19.1116783786232247), TestType(-31.8496900594998920),
+            TestType( 11.9399006843988076), TestType(-33.5714903719825912), TestType( 46.9218036475198801), TestType(-81.4228964658384768),
+        });
+
+        Mat4<TestType> expected;
+        Kernels::Multiply4x4Scalar(A.RawPtr(), B.RawPtr(), expected.RawPtr());
+
+        for (const auto level : {Kernels::SimdLevel::Scalar, Kernels::SimdLevel::AVX2, Kernels::SimdLevel::AVX512})
+        {
+            Mat4<TestType> C;
+
+            if (!Kernels::IsSupported(level))
+            {
+                REQUIRE_THROWS(Kernels::Multiply4x4(A.RawPtr(), B.RawPtr(), C.RawPtr(), level));
+                continue;
+            }
+
+            Kernels::Multiply4x4(A.RawPtr(), B.RawPtr(), C.RawPtr(), level);
+
+            for (size_t row = 0; row < C.rows(); ++row)
+            for (size_t col = 0; col < C.cols(); ++col)
+            {
+                INFO("Kernel " << Kernels::ToString(level) << " mismatch at (" << row << ", " << col << ")");
+                // fused multiply-add rounds differently than separate multiplication and addition
+                REQUIRE_THAT(C(row, col), Catch::Matchers::WithinRel(expected(row, col), std::numeric_limits<TestType>::epsilon() * TestType(100)));
+            }
+        }
+    }
+}
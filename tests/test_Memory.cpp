@@ -0,0 +1,77 @@
+#include "Memory.hpp"
+#include "Recorder.hpp"
+#include "TestHelper.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[Memory] Tracking allocator books current and peak bytes", "[Memory]")
+    {
+        MemoryAccount account;
+        {
+            TrackedVector<double> values{TrackingAllocator<double>(account)};
+            values.reserve(100);
+            REQUIRE(account.GetCurrent() == 100 * sizeof(double));
+
+            // growing holds the old and the new buffer at once
+            values.resize(101);
+            REQUIRE(account.GetCurrent() == values.capacity() * sizeof(double));
+            REQUIRE(account.GetPeak() == (100 + values.capacity()) * sizeof(double));
+
+            values.shrink_to_fit();
+            account.ResetPeak();
+            REQUIRE(account.GetPeak() == 101 * sizeof(double));
+        }
+        REQUIRE(account.GetCurrent() == 0);
+        REQUIRE(account.GetPeak() == 101 * sizeof(double));
+
+        MemoryAccount other;
+        REQUIRE(TrackingAllocator<double>(account) == TrackingAllocator<char>(account));
+        REQUIRE_FALSE(TrackingAllocator<double>(account) == TrackingAllocator<double>(other));
+    }
+
+    TEST_CASE("[Memory] Recorder books its entries", "[Memory]")
+    {
+        Recorder recorder;
+        recorder.ReadFile(std::string(PROJECT_ROOT_PATH) + "/data/UnitTest.txt");
+        recorder.ReserveOutput(recorder.GetData().size());
+
+        REQUIRE(recorder.GetInputMemory().GetCurrent()  == recorder.GetData().capacity() * sizeof(Entry));
+        REQUIRE(recorder.GetOutputMemory().GetCurrent() == recorder.GetData().size() * sizeof(Entry));
+        REQUIRE(recorder.GetInputMemory().GetPeak() >= recorder.GetInputMemory().GetCurrent());
+    }
+
+    TEST_CASE("[Memory] Resident set size", "[Memory]")
+    {
+        const ResidentMemory memory = GetResidentMemory();
+#if defined(__linux__)
+        REQUIRE(memory.current > 0);
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+        REQUIRE(memory.peak >= memory.current);
+        REQUIRE(memory.peak > 0);
+#endif
+    }
+
+    TEST_CASE("[Memory] Application reports read, integrate and export", "[Memory]")
+    {
+        ApplicationSettings settings;
+        settings.retain_output = true;
+        settings.memory_report = true;
+        const auto application = RunApplication(settings);
+
+        const auto &report = application->GetMemoryReport();
+        REQUIRE(report.size() == 3);
+        REQUIRE(report[0].name == "read");
+        REQUIRE(report[1].name == "integrate");
+        REQUIRE(report[2].name == "export");
+
+        const auto samples = application->GetRecorder().GetData().size();
+        REQUIRE(report[1].samples == samples - 1);
+        REQUIRE(report[1].input_bytes  >= samples * sizeof(Entry));
+        REQUIRE(report[1].output_bytes == samples * sizeof(Entry));
+        REQUIRE(report[2].transient_bytes > 0);
+        REQUIRE(report[2].GetBytesPerSample() >= 2.0 * sizeof(Entry));
+    }
+}
@@ -0,0 +1,107 @@
+#include "PerfCounters.hpp"
+#include "TestHelper.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[PerfCounters] Counts a loop or reports unavailable counters", "[PerfCounters]")
+    {
+        PerfCounters counters;
+
+        counters.Start();
+        volatile uint64_t sum = 0;
+        for (uint64_t i = 0; i < 1'000'000; ++i) sum = sum + i;
+        const PerfSample sample = counters.Stop();
+
+        if (!counters.IsAvailable())
+        {
+            // e.g. no PMU in a virtual machine, nothing is counted but nothing fails either
+            REQUIRE_FALSE(counters.GetError().empty());
+            for (size_t i = 0; i < PerfEventCount; ++i)
+            {
+                REQUIRE_FALSE(sample.Get(static_cast<PerfEvent>(i)).has_value());
+            }
+            REQUIRE_FALSE(sample.GetIPC().has_value());
+            return;
+        }
+
+        REQUIRE(counters.GetError().empty());
+        if (const auto instructions = sample.Get(PerfEvent::Instructions))
+        {
+            REQUIRE(*instructions >= 1'000'000);
+        }
+    }
+
+    TEST_CASE("[PerfCounters] Exited threads only count in their own interval", "[PerfCounters]")
+    {
+        PerfCounters counters;
+        if (!counters.IsAvailable()) return;
+
+        // workers that exit within the first interval, their counts are merged into the counters of this thread
+        constexpr uint64_t iterations = 10'000'000;
+        counters.Start();
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 4; ++t)
+        {
+            workers.emplace_back([]
+            {
+                volatile uint64_t sum = 0;
+                for (uint64_t i = 0; i < iterations; ++i) sum = sum + i;
+            });
+        }
+        for (auto &worker : workers) worker.join();
+        const PerfSample threaded = counters.Stop();
+
+        counters.Start();
+        volatile uint64_t sum = 0;
+        for (uint64_t i = 0; i < iterations / 10; ++i) sum = sum + i;
+        const PerfSample single = counters.Stop();
+
+        if (const auto instructions = threaded.Get(PerfEvent::Instructions))
+        {
+            REQUIRE(*instructions >= 4 * iterations);
+            REQUIRE(*single.Get(PerfEvent::Instructions) < iterations);
+        }
+    }
+
+    TEST_CASE("[PerfCounters] Derived metrics", "[PerfCounters]")
+    {
+        PerfSample sample;
+        REQUIRE_FALSE(sample.GetIPC().has_value());
+
+        sample.counts[static_cast<size_t>(PerfEvent::Cycles)]       = 1000;
+        sample.counts[static_cast<size_t>(PerfEvent::Instructions)] = 2500;
+        sample.counts[static_cast<size_t>(PerfEvent::L1DMisses)]    = 50;
+        sample.valid.fill(true);
+
+        REQUIRE(sample.GetIPC() == 2.5);
+        REQUIRE(sample.GetPer(PerfEvent::L1DMisses, 10) == 5.0);
+        REQUIRE_FALSE(sample.GetPer(PerfEvent::L1DMisses, 0).has_value());
+        REQUIRE(GetName(PerfEvent::LLCMisses) == "LLC misses");
+    }
+
+    TEST_CASE("[PerfCounters] Application reports read, integrate and export", "[PerfCounters]")
+    {
+        ApplicationSettings settings;
+        settings.perf_counters = true;
+        const auto application = RunApplication(settings);
+
+        const auto &report = application->GetPerfReport();
+        if (PerfCounters().IsAvailable())
+        {
+            REQUIRE(report.size() == 3);
+            REQUIRE(report[0].name == "read");
+            REQUIRE(report[1].name == "integrate");
+            REQUIRE(report[2].name == "export");
+            REQUIRE(report[1].samples == application->GetRecorder().GetData().size() - 1);
+        }
+        else
+        {
+            REQUIRE(report.empty());
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#include "Profiler.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[Profiler] Timers nest into a phase tree", "[Profiler]")
+    {
+        Profiler::Reset();
+        for (int i = 0; i < 3; ++i)
+        {
+            Profiler::ScopedTimer outer("outer");
+            {
+                Profiler::ScopedTimer inner("inner");
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            Profiler::ScopedTimer other("other");
+        }
+
+        const auto &root = Profiler::GetRoot();
+        REQUIRE(root.children.size() == 1);
+
+        const auto &outer = *root.children[0];
+        REQUIRE(outer.name == "outer");
+        REQUIRE(outer.count == 3);
+        REQUIRE(outer.children.size() == 2);
+        REQUIRE(root.total_ns == outer.total_ns);
+
+        const auto &inner = *outer.children[0];
+        REQUIRE(inner.name == "inner");
+        REQUIRE(inner.count == 3);
+        REQUIRE(inner.min_ns >= 2'000'000);
+        REQUIRE(inner.total_ns >= 6'000'000);
+        REQUIRE(outer.total_ns >= inner.total_ns + outer.children[1]->total_ns);
+        REQUIRE(outer.GetSelfTime() == outer.total_ns - inner.total_ns - outer.children[1]->total_ns);
+
+        // percentiles are estimates within the observed range
+        REQUIRE(inner.GetPercentile(50.0) >= inner.min_ns);
+        REQUIRE(inner.GetPercentile(99.0) <= inner.max_ns);
+
+        std::ostringstream summary;
+        Profiler::WriteSummary(summary);
+        REQUIRE(summary.str().find("    inner") != std::string::npos);
+
+        Profiler::Reset();
+        REQUIRE(Profiler::GetRoot().children.empty());
+    }
+
+    TEST_CASE("[Profiler] Histogram buckets and percentiles", "[Profiler]")
+    {
+        REQUIRE(Profiler::GetBucket(0) == 0);
+        REQUIRE(Profiler::GetBucket(3) == 3);
+        REQUIRE(Profiler::GetBucket(4) == 4);
+        REQUIRE(Profiler::GetBucket(7) == 7);
+        REQUIRE(Profiler::GetBucket(8) == 8);
+        REQUIRE(Profiler::GetBucket(1000) < Profiler::GetBucket(1300));
+        REQUIRE(Profiler::GetBucket(UINT64_MAX) == Profiler::BucketCount - 1);
+
+        Profiler::Phase phase;
+        REQUIRE(phase.GetPercentile(50.0) == 0);
+        for (uint64_t i = 0; i < 99; ++i) phase.Add(1000);
+        phase.Add(1'000'000);
+
+        REQUIRE(phase.count == 100);
+        REQUIRE(phase.GetPercentile(50.0) >= 1000);
+        REQUIRE(phase.GetPercentile(50.0) < 1200);
+        REQUIRE(phase.GetPercentile(99.0) < 1200);
+        REQUIRE(phase.GetPercentile(100.0) == 1'000'000);
+    }
+
+    TEST_CASE("[Profiler] JSON report", "[Profiler]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_Profiler.json";
+
+        Profiler::Reset();
+        {
+            Profiler::ScopedTimer timer("parse");
+        }
+        Profiler::WriteJSON(path.string());
+        Profiler::Reset();
+
+        std::ifstream file(path);
+        const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        REQUIRE(json.find("\"name\": \"total\"") != std::string::npos);
+        REQUIRE(json.find("\"name\": \"parse\"") != std::string::npos);
+        REQUIRE(json.find("\"p99_ns\"") != std::string::npos);
+
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,177 @@
+#include "Reconstruction.hpp"
+#include "AllocationCounter.hpp"
+#include "Error.hpp"
+#include "SyntheticFlight.hpp"
+#include "TestHelper.hpp"
+
+#include <filesystem>
+#include <ranges>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    // path of the deterministic synthetic flight of a test, UnitTest.txt only holds two samples
+    static auto GetSyntheticFlightPath() -> std::string
+    {
+        return (std::filesystem::temp_directory_path() / "FlightPath_test_Reconstruction.txt").string();
+    }
+
+    static auto ReadSyntheticFlight(Recorder &recorder, const size_t samples) -> void
+    {
+        const std::string input_path = GetSyntheticFlightPath();
+        WriteSyntheticFlight(input_path, samples);
+        recorder.ReadFile(input_path);
+        std::filesystem::remove(input_path);
+    }
+
+    TEST_CASE("[Reconstruction] Poses match the application", "[Reconstruction]")
+    {
+        const std::string input_path = GetSyntheticFlightPath();
+        WriteSyntheticFlight(input_path, 1000);
+
+        ApplicationSettings settings;
+        settings.retain_output = true;
+        const auto application = RunApplication(settings, input_path);
+        std::filesystem::remove(input_path);
+
+        const auto &input  = application->GetRecorder().GetData();
+        const auto &output = application->GetRecorder().GetOutputData();
+        REQUIRE(input.size() == 1000);
+        REQUIRE(output.size() == input.size());
+
+        std::vector<Pose> poses(input.size());
+        Reconstruct(input, GetInitialState(input[0]), poses);
+
+        for (size_t i = 0; i < poses.size(); ++i)
+        {
+            REQUIRE(poses[i].time               == output[i].time);
+            REQUIRE(poses[i].position.longitude == output[i].longitude);
+            REQUIRE(poses[i].position.latitude  == output[i].latitude);
+            REQUIRE(poses[i].position.altitude  == output[i].altitude);
+            REQUIRE(poses[i].attitude.heading   == output[i].true_heading);
+            REQUIRE(poses[i].attitude.pitch     == output[i].pitch);
+            REQUIRE(poses[i].attitude.roll      == output[i].roll);
+            REQUIRE(poses[i].velocity.x         == output[i].v_x);
+            REQUIRE(poses[i].velocity.y         == output[i].v_y);
+            REQUIRE(poses[i].velocity.z         == output[i].v_z);
+        }
+    }
+
+    TEST_CASE("[Reconstruction] Columns give the same poses without allocating", "[Reconstruction]")
+    {
+        Recorder recorder;
+        ReadSyntheticFlight(recorder, 1000);
+        const auto &input = recorder.GetData();
+
+        std::vector<double> time, a_x, a_y, a_z, omega_x, omega_y, omega_z;
+        for (const auto &entry : input)
+        {
+            time.push_back(entry.time);
+            a_x.push_back(entry.a_x);
+            a_y.push_back(entry.a_y);
+            a_z.push_back(entry.a_z);
+            omega_x.push_back(entry.omega_x);
+            omega_y.push_back(entry.omega_y);
+            omega_z.push_back(entry.omega_z);
+        }
+        const ImuColumns columns{.time = time, .a_x = a_x, .a_y = a_y, .a_z = a_z, .omega_x = omega_x, .omega_y = omega_y, .omega_z = omega_z};
+
+        const InitialState state = GetInitialState(input[0]);
+        std::vector<Pose> from_entries(input.size());
+        std::vector<Pose> from_columns(input.size());
+        {
+            AllocationCounter counter;
+            Reconstruct(input, state, from_entries);
+            Reconstruct(columns, state, from_columns);
+            REQUIRE(counter.GetAllocations() == 0);
+        }
+
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            REQUIRE(from_columns[i].position.longitude == from_entries[i].position.longitude);
+            REQUIRE(from_columns[i].position.latitude  == from_entries[i].position.latitude);
+            REQUIRE(from_columns[i].position.altitude  == from_entries[i].position.altitude);
+        }
+
+        // a partial window starts at any sample with a known state
+        std::vector<Pose> window(10);
+        Reconstruct(std::span(input).subspan(5, 10), GetInitialState(input[5]), window);
+        REQUIRE(window[0].time == input[5].time);
+        REQUIRE(window[9].time == input[14].time);
+    }
+
+    TEST_CASE("[Reconstruction] Invalid sizes", "[Reconstruction]")
+    {
+        std::vector<Entry> input(3);
+        std::vector<Pose>  output(2);
+        const InitialState state = GetInitialState(input[0]);
+
+        REQUIRE_THROWS_AS(Reconstruct(input, state, output), Exception);
+        REQUIRE_THROWS_AS(Reconstruct(std::span<const Entry>(), state, std::span<Pose>()), Exception);
+
+        const std::vector<double> three(3), two(2);
+        const ImuColumns columns{.time = three, .a_x = three, .a_y = three, .a_z = two, .omega_x = three, .omega_y = three, .omega_z = three};
+        output.resize(3);
+        REQUIRE_THROWS_AS(Reconstruct(columns, state, output), Exception);
+    }
+
+    TEST_CASE("[Reconstruction] Generated poses match the computed ones", "[Reconstruction]")
+    {
+        Recorder recorder;
+        ReadSyntheticFlight(recorder, 1000);
+        const auto &input = recorder.GetData();
+        const InitialState state = GetInitialState(input[0]);
+
+        std::vector<Pose> poses(input.size());
+        Reconstruct(input, state, poses);
+
+        size_t count = 0;
+        for (const Pose &pose : GeneratePoses(input, state))
+        {
+            REQUIRE(pose.time               == poses[count].time);
+            REQUIRE(pose.position.longitude == poses[count].position.longitude);
+            REQUIRE(pose.position.latitude  == poses[count].position.latitude);
+            REQUIRE(pose.position.altitude  == poses[count].position.altitude);
+            REQUIRE(pose.attitude.heading   == poses[count].attitude.heading);
+            ++count;
+        }
+        REQUIRE(count == input.size());
+
+        auto empty = GeneratePoses(std::span<const Entry>(), state);
+        REQUIRE(empty.begin() == empty.end());
+    }
+
+    TEST_CASE("[Reconstruction] Generated poses compose with range adaptors", "[Reconstruction]")
+    {
+        static_assert(std::ranges::input_range<Generator<Pose>> && std::ranges::view<Generator<Pose>>);
+
+        Recorder recorder;
+        ReadSyntheticFlight(recorder, 1000);
+        const auto &input = recorder.GetData();
+        const double end_time = input[input.size() / 2].time;
+
+        // stops at the first pose past end_time, the rest of the flight is never computed
+        size_t count = 0;
+        for (const Pose &pose : GeneratePoses(input, GetInitialState(input[0]))
+                              | std::views::take_while([end_time](const Pose &pose) { return pose.time <= end_time; }))
+        {
+            REQUIRE(pose.time == input[count].time);
+            ++count;
+        }
+        REQUIRE(count == input.size() / 2 + 1);
+
+        // the first 4 poses
+        std::vector<double> times;
+        for (const Pose &pose : GeneratePoses(input, GetInitialState(input[0])) | std::views::take(4))
+        {
+            times.push_back(pose.time);
+        }
+        REQUIRE(times == std::vector<double>{input[0].time, input[1].time, input[2].time, input[3].time});
+
+        const std::vector<double> three(3), two(2);
+        const ImuColumns columns{.time = three, .a_x = three, .a_y = three, .a_z = three, .omega_x = two, .omega_y = three, .omega_z = three};
+        REQUIRE_THROWS_AS(GeneratePoses(columns, GetInitialState(input[0])), Exception);
+    }
+}
@@ -0,0 +1,164 @@
+#include "Simplify.hpp"
+#include "TestHelper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    // squared distance of point p to the line segment a-b
+    static auto SquaredDistanceToSegment(const Vec3<double> &p, const Vec3<double> &a, const Vec3<double> &b) -> double
+    {
+        const Vec3<double> ab = b - a;
+        const Vec3<double> ap = p - a;
+        const double length_squared = ab.LengthSquared();
+        const double t = length_squared > 0.0 ? std::clamp(ap.Dot(ab) / length_squared, 0.0, 1.0) : 0.0;
+        return (ap - ab * t).LengthSquared();
+    }
+
+    // distance of point p to the polyline through the kept points around it
+    static auto DistanceToSimplified(const Vec3Array<double> &points, const std::vector<size_t> &kept, const size_t index) -> double
+    {
+        const auto upper = std::upper_bound(kept.begin(), kept.end(), index);
+        if (upper == kept.end() || upper == kept.begin()) return 0.0;
+
+        const Vec3<double> a  = points.Get(*(upper - 1));
+        const Vec3<double> b  = points.Get(*upper);
+        const Vec3<double> p  = points.Get(index);
+        const Vec3<double> ab = b - a;
+        const Vec3<double> ap = p - a;
+        const double t = std::clamp(ap.Dot(ab) / ab.LengthSquared(), 0.0, 1.0);
+        const Vec3<double> d = ap - ab * t;
+        return d.Length();
+    }
+
+    TEST_CASE("[Simplify] Straight line is reduced to its end points", "[Simplify]")
+    {
+        Vec3Array<double> points;
+        for (int i = 0; i < 1000; ++i)
+        {
+            points.PushBack(Vec3<double>(i * 2.0, i * -1.0, 0.5 * i));
+        }
+
+        const auto kept = Simplify(points, 0.01, 64);
+        REQUIRE(kept.front() == 0);
+        REQUIRE(kept.back() == 999);
+
+        // only segment boundaries remain
+        REQUIRE(kept.size() == (999 + 62) / 63 + 1);
+    }
+
+    TEST_CASE("[Simplify] Removed points are within the tolerance", "[Simplify]")
+    {
+        Vec3Array<double> points;
+        for (int i = 0; i < 5000; ++i)
+        {
+            const double t = i * 0.01;
+            points.PushBack(Vec3<double>(100.0 * t, 50.0 * std::sin(t), 5.0 * std::cos(3.0 * t)));
+        }
+
+        for (const size_t segment_size : {size_t(100), size_t(4096), size_t(100000)})
+        {
+            const auto kept = Simplify(points, 0.5, segment_size);
+            REQUIRE(kept.size() < points.size() / 10);
+            REQUIRE(std::is_sorted(kept.begin(), kept.end()));
+
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                REQUIRE(DistanceToSimplified(points, kept, i) <= 0.5);
+            }
+        }
+    }
+
+    TEST_CASE("[Simplify] Track of recorded entries", "[Simplify]")
+    {
+        Recorder recorder;
+        recorder.ReadFile(std::string(PROJECT_ROOT_PATH) + "/data/UnitTest.txt");
+
+        const auto kept = SimplifyTrack(recorder.GetData(), 1.0);
+        REQUIRE(kept == std::vector<size_t>{0, 1});
+
+        REQUIRE(Simplify(Vec3Array<double>(), 1.0).empty());
+        REQUIRE_THROWS(Simplify(Vec3Array<double>(3), -1.0));
+        REQUIRE_THROWS(Simplify(Vec3Array<double>(3),  1.0, 1));
+    }
+
+    TEST_CASE("[Simplify] Streaming simplification stays within the tolerance", "[Simplify]")
+    {
+        Vec3Array<double> points;
+        for (int i = 0; i < 5000; ++i)
+        {
+            const double t = i * 0.01;
+            points.PushBack(Vec3<double>(100.0 * t, 50.0 * std::sin(t), 5.0 * std::cos(3.0 * t)));
+        }
+
+        for (const size_t window_size : {size_t(8), size_t(64), StreamingSimplifier::DefaultWindowSize})
+        {
+            // same bookkeeping as KMLSink: first point immediately, previous point on request, last point at the end
+            StreamingSimplifier simplifier(0.5, window_size);
+            std::vector<size_t> kept{0};
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                if (simplifier.Push(points.Get(i))) kept.push_back(i - 1);
+            }
+            kept.push_back(points.size() - 1);
+
+            REQUIRE(kept.size() < points.size() / 4);
+            for (size_t k = 1; k < kept.size(); ++k)
+            {
+                REQUIRE(kept[k] > kept[k - 1]);
+                REQUIRE(kept[k] - kept[k - 1] <= window_size);
+            }
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                REQUIRE(DistanceToSimplified(points, kept, i) <= 0.5);
+            }
+        }
+
+        REQUIRE_THROWS(StreamingSimplifier(-1.0));
+        REQUIRE_THROWS(StreamingSimplifier(1.0, 0));
+    }
+
+    TEST_CASE("[Simplify] Streaming simplification matches checking every point", "[Simplify]")
+    {
+        // a winding climb with straight legs, where the cone decides most points
+        Vec3Array<double> points;
+        for (int i = 0; i < 5000; ++i)
+        {
+            const double t = i * 0.01;
+            const double turn = std::floor(t / 10.0) + std::clamp(std::fmod(t, 10.0) - 8.0, 0.0, 1.0);
+            points.PushBack(Vec3<double>(100.0 * t + 20.0 * std::cos(turn), 30.0 * std::sin(turn) + 0.01 * std::sin(7.0 * t), 2.0 * t));
+        }
+
+        for (const double tolerance : {0.0, 0.05, 0.5, 5.0})
+        {
+            StreamingSimplifier simplifier(tolerance, 64);
+
+            // reference: opening window checking all window points for every point
+            std::vector<Vec3<double>> window;
+            Vec3<double> anchor = points.Get(0);
+            REQUIRE_FALSE(simplifier.Push(anchor));
+
+            for (size_t i = 1; i < points.size(); ++i)
+            {
+                const Vec3<double> point = points.Get(i);
+                bool fits = window.size() < 64;
+                for (size_t k = 0; fits && k < window.size(); ++k)
+                {
+                    fits = SquaredDistanceToSegment(window[k], anchor, point) <= tolerance * tolerance;
+                }
+
+                REQUIRE(simplifier.Push(point) == !fits);
+                if (!fits)
+                {
+                    anchor = window.back();
+                    window.clear();
+                }
+                window.push_back(point);
+            }
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#include "SyntheticFlight.hpp"
+#include "TestHelper.hpp"
+
+#include <filesystem>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[SyntheticFlight] Reconstruction reproduces the generated track", "[SyntheticFlight]")
+    {
+        const auto input_path = std::filesystem::temp_directory_path() / "FlightPath_test_SyntheticFlight.txt";
+        constexpr size_t count = 30000;
+
+        WriteSyntheticFlight(input_path.string(), count);
+
+        ApplicationSettings settings;
+        settings.retain_output = true;
+        const auto application = RunApplication(settings, input_path.string());
+        std::filesystem::remove(input_path);
+
+        const auto &input  = application->GetRecorder().GetData();
+        const auto &output = application->GetRecorder().GetOutputData();
+        REQUIRE(input.size() == count);
+        REQUIRE(output.size() == count);
+
+        // the script turns and climbs, the logged track is reproduced up to the precision of the file
+        CheckReal<double>(input.front().true_heading, 90.0_deg);
+        REQUIRE(input.back().time == 299.99);
+        for (size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(output[i].time == input[i].time);
+            REQUIRE_THAT(output[i].longitude, Catch::Matchers::WithinAbs(input[i].longitude, 1e-8));
+            REQUIRE_THAT(output[i].latitude,  Catch::Matchers::WithinAbs(input[i].latitude,  1e-8));
+            REQUIRE_THAT(output[i].altitude,  Catch::Matchers::WithinAbs(input[i].altitude,  0.06));
+        }
+    }
+
+    TEST_CASE("[SyntheticFlight] Invalid settings throw", "[SyntheticFlight]")
+    {
+        const auto path = (std::filesystem::temp_directory_path() / "FlightPath_test_SyntheticFlight_invalid.txt").string();
+
+        REQUIRE_THROWS(WriteSyntheticFlight(path, 10, SyntheticFlightSettings{.sample_rate = 0.0}));
+        REQUIRE_THROWS(WriteSyntheticFlight(path, 10, SyntheticFlightSettings{.script = {}}));
+        REQUIRE_THROWS(WriteSyntheticFlight(path, 10, SyntheticFlightSettings{.script = {{.maneuver = FlightSegment::Maneuver::Cruise, .duration = 0.0}}}));
+
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,80 @@
+#include "TimeIndex.hpp"
+#include "Error.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[TimeIndex] Finds samples of an evenly sampled log", "[TimeIndex]")
+    {
+        std::vector<double> times(1000);
+        for (size_t i = 0; i < times.size(); ++i) times[i] = 100.0 + 0.01 * static_cast<double>(i);
+
+        const TimeIndex index(times, 16);
+        REQUIRE(index.size() == 1000);
+
+        REQUIRE(index.FindIndex(100.0)   == 0);
+        REQUIRE(index.FindIndex(100.055) == 5);
+        REQUIRE(index.FindIndex(times[321]) == 321);
+        REQUIRE(index.FindIndex(50.0)    == 0);
+        REQUIRE(index.FindIndex(1e9)     == 999);
+
+        REQUIRE(index.LowerBound(100.055) == 6);
+        REQUIRE(index.UpperBound(times[321]) == 322);
+        REQUIRE(index.LowerBound(1e9) == 1000);
+
+        const TimeRange range = index.FindRange(times[10], times[20]);
+        REQUIRE(range.begin == 10);
+        REQUIRE(range.end   == 21);
+        REQUIRE(range.size() == 11);
+        REQUIRE(index.FindRange(times[20], times[10]).empty());
+        REQUIRE(index.FindRange(0.0, 1.0).empty());
+    }
+
+    TEST_CASE("[TimeIndex] Matches a binary search on uneven logs with repeated times", "[TimeIndex]")
+    {
+        std::mt19937_64 random(42);
+        std::exponential_distribution<double> gap(1.0);
+
+        std::vector<Entry> entries(5000);
+        double time = 0.0;
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            // bursts of equal times and long gaps
+            if (i % 7 != 0) time += gap(random) * (i % 500 == 0 ? 1000.0 : 0.01);
+            entries[i].time = time;
+        }
+
+        for (const size_t block_size : {1, 3, 64, 10000})
+        {
+            const TimeIndex index(entries, block_size);
+            std::uniform_real_distribution<double> query(-1.0, time + 1.0);
+            for (int i = 0; i < 2000; ++i)
+            {
+                const double t = i % 2 == 0 ? query(random) : entries[random() % entries.size()].time;
+                const auto lower = std::ranges::lower_bound(entries, t, {}, &Entry::time);
+                const auto upper = std::ranges::upper_bound(entries, t, {}, &Entry::time);
+                REQUIRE(index.LowerBound(t) == static_cast<size_t>(lower - entries.begin()));
+                REQUIRE(index.UpperBound(t) == static_cast<size_t>(upper - entries.begin()));
+            }
+        }
+    }
+
+    TEST_CASE("[TimeIndex] Invalid input", "[TimeIndex]")
+    {
+        const std::vector<double> descending{0.0, 1.0, 2.0, 1.5};
+        REQUIRE_THROWS_AS(TimeIndex(std::span<const double>()), Exception);
+        REQUIRE_THROWS_AS(TimeIndex(descending, 0), Exception);
+        REQUIRE_THROWS_AS(TimeIndex(descending, 1), Exception);
+
+        const std::vector<double> one{5.0};
+        const TimeIndex single(one);
+        REQUIRE(single.FindIndex(4.0) == 0);
+        REQUIRE(single.FindIndex(6.0) == 0);
+        REQUIRE(single.FindRange(5.0, 5.0).size() == 1);
+    }
+}
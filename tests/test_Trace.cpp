@@ -0,0 +1,115 @@
+#include "Trace.hpp"
+#include "Application.hpp"
+#include "Error.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    static auto ReadText(const std::filesystem::path &path) -> std::string
+    {
+        std::ifstream file(path);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    static auto Count(const std::string &text, const std::string &pattern) -> size_t
+    {
+        size_t count = 0;
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) ++count;
+        return count;
+    }
+
+    TEST_CASE("[Trace] Spans of all threads are written as trace events", "[Trace]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_Trace.json";
+        constexpr size_t thread_count = 4;
+        constexpr size_t span_count   = 1000;
+
+        {
+            Trace::Span span("before the session");
+        }
+
+        Trace::Open(path.string());
+        REQUIRE(Trace::IsOpen());
+        REQUIRE_THROWS(Trace::Open(path.string()));
+        {
+            Trace::Span span("main");
+
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < thread_count; ++t)
+            {
+                threads.emplace_back([]
+                {
+                    for (size_t i = 0; i < span_count; ++i)
+                    {
+                        Trace::Span span("worker");
+                    }
+                });
+            }
+            for (auto &thread : threads) thread.join();
+        }
+        Trace::Close();
+        REQUIRE_FALSE(Trace::IsOpen());
+
+        {
+            Trace::Span span("after the session");
+        }
+
+        const std::string json = ReadText(path);
+        REQUIRE(json.starts_with("{\"traceEvents\": ["));
+        REQUIRE(Count(json, "\"name\": \"worker\"") == thread_count * span_count);
+        REQUIRE(Count(json, "\"name\": \"main\"") == 1);
+        REQUIRE(Count(json, "session") == 0);
+
+        // one track per thread, named by metadata events
+        REQUIRE(Count(json, "\"ph\": \"M\"") == thread_count + 1);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("[Trace] Close without a session does nothing", "[Trace]")
+    {
+        REQUIRE_FALSE(Trace::IsOpen());
+        REQUIRE_NOTHROW(Trace::Close());
+    }
+
+    TEST_CASE("[Trace] Session ends with its scope", "[Trace]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_Trace_session.json";
+
+        REQUIRE_THROWS([&path]
+        {
+            Trace::Session session(path.string());
+            Trace::Span span("unwound");
+            throw Exception("abort");
+        }());
+        REQUIRE_FALSE(Trace::IsOpen());
+        REQUIRE(Count(ReadText(path), "\"name\": \"unwound\"") == 1);
+
+        {
+            Trace::Session session(path.string());
+            session.Close();
+            REQUIRE_FALSE(Trace::IsOpen());
+
+            // the next session is not closed by the destructor of the first one
+            Trace::Open(path.string());
+        }
+        REQUIRE(Trace::IsOpen());
+        Trace::Close();
+
+        // an application that throws while reading does not leave its session open
+        ApplicationSettings settings;
+        settings.input_path = "this/file/does/not/exist.txt";
+        settings.trace_path = path.string();
+        REQUIRE_THROWS(Application(settings));
+        REQUIRE_FALSE(Trace::IsOpen());
+
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,109 @@
+#include "TrajectoryStore.hpp"
+#include "TestHelper.hpp"
+
+#include <filesystem>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace FlightPath
+{
+    TEST_CASE("[TrajectoryStore] Recorder appends to a mapped store", "[TrajectoryStore]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_TrajectoryStore.fpc";
+        {
+            Recorder recorder;
+            recorder.ReadFile(std::string(PROJECT_ROOT_PATH) + "/data/UnitTest.txt");
+            recorder.OpenStore(path.string());
+
+            const TrajectoryView view(path.string());
+            REQUIRE(view.GetCapacity() == recorder.GetData().size());
+            REQUIRE(view.GetSize() == 1);
+
+            recorder.WriteData(
+                FlightPath::Position{15.76_deg, 42.9_deg, 3658.4_m},
+                FlightPath::Attitude{180.1_deg, 0.3_deg, -0.5_deg},
+                FlightPath::Vec3{.x=171.0, .y=-1.3, .z=0.5}
+            );
+
+            // the view sees the new entry without remapping
+            REQUIRE(view.GetSize() == 2);
+            const auto altitude = view.GetColumn("altitude");
+            REQUIRE(altitude.size() == 2);
+            CheckReal<double>(altitude[0], 3657.4);
+            CheckReal<double>(altitude[1], 3658.4);
+
+            const auto &expected = recorder.GetOutputData();
+            for (uint64_t i = 0; i < view.GetSize(); ++i)
+            {
+                const Entry entry = view.GetEntry(i);
+                for (const auto &field : Columnar::GetEntryFields())
+                {
+                    REQUIRE(entry.*field.member == expected[i].*field.member);
+                }
+            }
+            REQUIRE_THROWS(view.GetEntry(2));
+
+            // a store is a valid columnar file
+            const Columnar::Reader reader(path.string());
+            REQUIRE(reader.GetHeader().row_count == 2);
+            REQUIRE(reader.GetColumn("altitude")[1] == altitude[1]);
+        }
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("[TrajectoryStore] Concurrent reader only sees complete entries", "[TrajectoryStore]")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "FlightPath_test_TrajectoryStore_concurrent.fpc";
+        constexpr uint64_t count = 20000;
+
+        {
+            TrajectoryStore store(path.string(), count);
+            const TrajectoryView view(path.string());
+
+            std::thread writer([&store]
+            {
+                for (uint64_t i = 0; i < count; ++i)
+                {
+                    Entry entry{};
+                    for (const auto &field : Columnar::GetEntryFields())
+                    {
+                        entry.*field.member = static_cast<double>(i);
+                    }
+                    store.Append(entry);
+                }
+            });
+
+            bool complete = true;
+            uint64_t size = 0;
+            while (size < count)
+            {
+                size = view.GetSize();
+                if (size > 0)
+                {
+                    const Entry entry = view.GetEntry(size - 1);
+                    for (const auto &field : Columnar::GetEntryFields())
+                    {
+                        complete = complete && entry.*field.member == static_cast<double>(size - 1);
+                    }
+                }
+            }
+            writer.join();
+
+            REQUIRE(complete);
+            REQUIRE(view.GetColumn("a_z").size() == count);
+            REQUIRE_THROWS(store.Append(Entry{}));
+        }
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("[TrajectoryStore] Rejects missing and invalid files", "[TrajectoryStore]")
+    {
+        REQUIRE_THROWS(TrajectoryView("this/file/does/not/exist.fpc"));
+
+        Recorder recorder;
+        REQUIRE_THROWS(recorder.OpenStore((std::filesystem::temp_directory_path() / "FlightPath_test_TrajectoryStore_empty.fpc").string()));
+
+        REQUIRE_THROWS(TrajectoryView(std::string(PROJECT_ROOT_PATH) + "/data/UnitTest.txt"));
+    }
+}
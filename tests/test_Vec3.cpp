@@ -35,6 +35,36 @@ namespace FlightPath
         CheckVec3<TestType>(c, Vec3<TestType>(5.0, 10.0, 15.0));
     }
 
+    TEMPLATE_TEST_CASE("[Vec3] chained expression", "[Vec3]", float, double)
+    {
+        Vec3<TestType> a{.x=1.0, .y=2.0, .z= 3.0};
+        Vec3<TestType> b{.x=1.0, .y=5.0, .z=-1.0};
+
+        Vec3<TestType> c = a + b * 2.0 - 0.5 * a;
+        CheckVec3<TestType>(c, Vec3<TestType>(2.5, 11.0, -0.5));
+
+        // temporaries are valid operands
+        Vec3<TestType> d = a - a.Cross(b) * 2.0;
+        CheckVec3<TestType>(d, Vec3<TestType>(35.0, -6.0, -3.0));
+
+        // the vector may appear on both sides of an assignment
+        a = b - a * 2.0;
+        CheckVec3<TestType>(a, Vec3<TestType>(-1.0, 1.0, -7.0));
+    }
+
+    TEMPLATE_TEST_CASE("[Vec3] operations on results", "[Vec3]", float, double)
+    {
+        const Vec3<TestType> a{.x=1.0, .y=2.0, .z= 3.0};
+        const Vec3<TestType> b{.x=1.0, .y=5.0, .z=-1.0};
+
+        CheckReal<TestType>((a + b).Dot(a), 22.0);
+        CheckReal<TestType>((a - b).Length(), 5.0);
+        CheckVec3<TestType>(Vec3<TestType>{a + b}, Vec3<TestType>(2.0, 7.0, 2.0));
+
+        const auto c = a - b * 2.0;
+        CheckVec3<TestType>(c, Vec3<TestType>(-1.0, -8.0, 5.0));
+    }
+
     TEMPLATE_TEST_CASE("[Vec3] dot product", "[Vec3]", float, double)
     {
         Vec3<TestType> a{.x=1.0, .y=2.0, .z= 3.0};
@@ -0,0 +1,102 @@
+#include "Vec3Array.hpp"
+#include "TestHelper.hpp"
+
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+namespace FlightPath
+{
+    // deterministic, non-trivial vectors (odd sizes also exercise the scalar remainder of vectorized loops)
+    template <typename REAL>
+    static auto MakeVectors(const size_t n, const REAL offset) -> std::vector<Vec3<REAL>>
+    {
+        std::vector<Vec3<REAL>> result;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const REAL t = REAL(i) + offset;
+            result.push_back(Vec3<REAL>{.x = t, .y = REAL(2.0) - t, .z = REAL(0.5) * t + REAL(1.0)});
+        }
+        return result;
+    }
+
+    template <typename REAL>
+    static auto ToArray(const std::vector<Vec3<REAL>> &vectors) -> Vec3Array<REAL>
+    {
+        Vec3Array<REAL> result;
+        result.Reserve(vectors.size());
+        for (const auto &v : vectors)
+        {
+            result.PushBack(v);
+        }
+        return result;
+    }
+
+    TEMPLATE_TEST_CASE("[Vec3Array] Storage is aligned", "[Vec3Array]", float, double)
+    {
+        Vec3Array<TestType> a(37);
+
+        REQUIRE(a.size() == 37);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(a.X().data()) % 64 == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(a.Y().data()) % 64 == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(a.Z().data()) % 64 == 0);
+
+        a.Set(36, Vec3<TestType>(1.0, 2.0, 3.0));
+        CheckVec3<TestType>(a.Get(36), Vec3<TestType>(1.0, 2.0, 3.0));
+    }
+
+    TEMPLATE_TEST_CASE("[Vec3Array] Batch operations match Vec3", "[Vec3Array]", float, double)
+    {
+        const auto va = MakeVectors<TestType>(37, TestType(0.25));
+        const auto vb = MakeVectors<TestType>(37, TestType(-3.0));
+        const auto a  = ToArray(va);
+        const auto b  = ToArray(vb);
+
+        const auto sum        = a + b;
+        const auto difference = a - b;
+        const auto scaled     = a * TestType(3.0);
+        const auto cross      = a.Cross(b);
+        const auto dot        = a.Dot(b);
+        const auto length     = a.Length();
+        auto       normalized = a;
+        normalized.Normalize();
+
+        for (size_t i = 0; i < va.size(); ++i)
+        {
+            const Vec3<TestType> expected_sum        = va[i] + vb[i];
+            const Vec3<TestType> expected_difference = va[i] - vb[i];
+            const Vec3<TestType> expected_scaled     = va[i] * TestType(3.0);
+
+            CheckVec3<TestType>(sum.Get(i),        expected_sum);
+            CheckVec3<TestType>(difference.Get(i), expected_difference);
+            CheckVec3<TestType>(scaled.Get(i),     expected_scaled);
+            CheckVec3<TestType>(cross.Get(i),      va[i].Cross(vb[i]));
+            CheckReal<TestType>(dot[i],            va[i].Dot(vb[i]));
+            CheckReal<TestType>(length[i],         va[i].Length(), TestType(2.0));
+            CheckReal<TestType>(normalized.Get(i).Length(), TestType(1.0), TestType(4.0));
+        }
+    }
+
+    TEMPLATE_TEST_CASE("[Vec3Array] Views and gather", "[Vec3Array]", float, double)
+    {
+        struct Sample
+        {
+            TestType time;
+            TestType a_x, a_y, a_z;
+        };
+
+        const std::vector<Sample> samples = {{0.0, 1.0, 2.0, 3.0}, {1.0, 4.0, 5.0, 6.0}, {2.0, 7.0, 8.0, 9.0}};
+        auto a = Vec3Array<TestType>::Gather(std::span<const Sample>(samples), &Sample::a_x, &Sample::a_y, &Sample::a_z);
+        CheckVec3<TestType>(a.Get(2), Vec3<TestType>(7.0, 8.0, 9.0));
+
+        // in-place a = a + a on the first two vectors only
+        const auto head = Vec3View<TestType>{.x = a.View().x.first(2), .y = a.View().y.first(2), .z = a.View().z.first(2)};
+        Add<TestType>(head, head, head);
+        CheckVec3<TestType>(a.Get(1), Vec3<TestType>(8.0, 10.0, 12.0));
+        CheckVec3<TestType>(a.Get(2), Vec3<TestType>(7.0, 8.0, 9.0));
+
+        Vec3Array<TestType> out(2);
+        REQUIRE_THROWS(Add<TestType>(a.View(), a.View(), out.View()));
+    }
+}